@@ -0,0 +1,412 @@
+#include "integer.hpp"
+#include "serialize.hpp"
+#include "parallel.hpp"
+
+#include <cstdlib>   // std::strtoul, std::strtod, std::rand, std::srand, std::exit
+#include <algorithm> // std::sort, std::find
+#include <fstream>   // std::ofstream
+#include <iostream>  // std::cout, std::cerr, std::ostream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include <time.h> // clock_gettime, CLOCK_MONOTONIC
+
+
+// Operation timed by the benchmark
+enum operation_t {
+    MUL,
+    SQR,
+    DIV,
+    MOD,
+    ADD,
+    SUB,
+    SHL,
+    SHR,
+    AND,
+    OR,
+    XOR,
+    CMP,
+    POW,
+    STR,
+    PARSE
+};
+
+// Names of the operations, in the order of operation_t
+static const char *const names[] = {"mul", "sqr", "div", "mod", "add", "sub", "shl", "shr", "and", "or", "xor", "cmp", "pow", "str", "parse"};
+static const std::size_t operation_count = sizeof(names) / sizeof(*names);
+
+// Benchmark options
+struct options_t {
+    // Output format, csv or json
+    std::string format;
+
+    // Output file, the standard output if empty
+    std::string output;
+
+    // Operations to run, all of them if empty
+    std::vector<operation_t> operations;
+
+    // Smallest and largest operand sizes in data blocks
+    std::size_t min_size;
+    std::size_t max_size;
+
+    // Warmup samples and measured samples of each benchmark
+    std::size_t warmup;
+    std::size_t samples;
+
+    // Minimum time of each sample in seconds, repeating the operation
+    double sample_time;
+
+    // Time of a single operation in seconds above which the larger sizes of
+    // the same operation are skipped
+    double limit;
+
+    // Threads used by the large products
+    std::size_t workers;
+};
+
+// Result of a benchmark
+struct result_t {
+    // Operation and operand size in data blocks
+    std::string operation;
+    std::size_t size;
+
+    // Operations of each sample
+    std::size_t iterations;
+
+    // Time of each operation in nanoseconds
+    double min;
+    double median;
+    double mean;
+};
+
+// Operands of a size, built once for all the operations
+struct operands_t {
+    bnl::integer a;
+    bnl::integer b;
+    bnl::integer wide;
+    bnl::integer base;
+    bnl::integer exponent;
+    bnl::integer shift;
+    std::string digits;
+};
+
+
+// Timing
+
+// Monotonic time in seconds
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Result of the last operation, kept so it isn't optimized out
+static bnl::integer sink;
+static std::size_t sink_size = 0;
+
+// Run the operation the given times and returns the elapsed seconds. The
+// operation is resolved before the timing, so the dispatch is a single switch
+static double run(const operation_t &operation, const operands_t &n, const std::size_t &iterations) {
+    const double start = now();
+
+    for (std::size_t i = 0; i < iterations; i++) {
+        switch (operation) {
+            case MUL:
+                sink = n.a * n.b;
+                break;
+
+            case SQR:
+                sink = n.a * n.a;
+                break;
+
+            case DIV:
+                sink = n.wide / n.b;
+                break;
+
+            case MOD:
+                sink = n.wide % n.b;
+                break;
+
+            case ADD:
+                sink = n.a + n.b;
+                break;
+
+            case SUB:
+                sink = n.a - n.b;
+                break;
+
+            case SHL:
+                sink = n.a << n.shift;
+                break;
+
+            case SHR:
+                sink = n.a >> n.shift;
+                break;
+
+            case AND:
+                sink = n.a & n.b;
+                break;
+
+            case OR:
+                sink = n.a | n.b;
+                break;
+
+            case XOR:
+                sink = n.a ^ n.b;
+                break;
+
+            case CMP:
+                sink_size += n.a < n.b;
+                break;
+
+            case POW:
+                sink = bnl::pow(n.base, n.exponent);
+                break;
+
+            case STR:
+                sink_size += bnl::str(n.a).size();
+                break;
+
+            case PARSE:
+                sink = bnl::integer(n.digits);
+                break;
+        }
+    }
+
+    return now() - start;
+}
+
+
+// Operands
+
+// Random number of exactly the given data blocks
+static const bnl::integer number(const std::size_t &size) {
+    std::vector<bnl::uchar> bytes(size << 2);
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<bnl::uchar>(std::rand());
+
+    // The most significative byte isn't zero
+    bytes[0] |= 0x80;
+    return bnl::import_bytes(bytes);
+}
+
+// Operands of the given size. The dividend has twice the size of the divisor,
+// the power has about the given size, and the shifts move a non whole number
+// of data blocks
+static void build(const std::size_t &size, operands_t &n, const bool &digits) {
+    n.a = number(size);
+    n.b = number(size);
+    n.wide = number(size << 1);
+    n.base = number(1);
+    n.exponent = bnl::integer(static_cast<bnl::ldouble>(size));
+    n.shift = bnl::integer(static_cast<bnl::ldouble>(((size << 5) >> 1) + 7));
+
+    // Only the parse benchmark needs the digits
+    n.digits = digits ? bnl::str(n.a) : std::string();
+}
+
+
+// Output
+
+// Write the results as CSV
+static void csv(std::ostream &stream, const std::vector<result_t> &results) {
+    stream << "operation,size,bits,iterations,min_ns,median_ns,mean_ns,ops_per_second,blocks_per_second" << std::endl;
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const result_t &r = results[i];
+        stream << r.operation << "," << r.size << "," << (r.size << 5) << "," << r.iterations << ","
+               << r.min << "," << r.median << "," << r.mean << ","
+               << 1e9 / r.median << "," << r.size * 1e9 / r.median << std::endl;
+    }
+}
+
+// Write the results as JSON
+static void json(std::ostream &stream, const std::vector<result_t> &results, const options_t &options) {
+    stream << "{" << std::endl;
+    stream << "  \"workers\": " << options.workers << "," << std::endl;
+    stream << "  \"samples\": " << options.samples << "," << std::endl;
+    stream << "  \"warmup\": " << options.warmup << "," << std::endl;
+    stream << "  \"results\": [" << std::endl;
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const result_t &r = results[i];
+        stream << "    {\"operation\": \"" << r.operation << "\", \"size\": " << r.size << ", \"bits\": " << (r.size << 5)
+               << ", \"iterations\": " << r.iterations << ", \"min_ns\": " << r.min << ", \"median_ns\": " << r.median
+               << ", \"mean_ns\": " << r.mean << ", \"ops_per_second\": " << 1e9 / r.median
+               << ", \"blocks_per_second\": " << r.size * 1e9 / r.median << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    stream << "  ]" << std::endl;
+    stream << "}" << std::endl;
+}
+
+
+// Command line
+
+// Print the usage and exit
+static void usage(const int &status) {
+    std::cerr << "Usage: bnl-bench [options]" << std::endl
+              << "  --format csv|json   Output format (csv)" << std::endl
+              << "  --output FILE       Output file (standard output)" << std::endl
+              << "  --ops LIST          Comma separated operations (all): mul,sqr,div,mod,add,sub," << std::endl
+              << "                      shl,shr,and,or,xor,cmp,pow,str,parse" << std::endl
+              << "  --min BLOCKS        Smallest operand size in data blocks (1)" << std::endl
+              << "  --max BLOCKS        Largest operand size in data blocks (10000000)" << std::endl
+              << "  --warmup N          Warmup samples (1)" << std::endl
+              << "  --samples N         Measured samples (5)" << std::endl
+              << "  --sample-time S     Minimum seconds of each sample (0.05)" << std::endl
+              << "  --limit S           Skip the larger sizes of an operation slower than this (10)" << std::endl
+              << "  --workers N         Threads used by the large products (1)" << std::endl;
+
+    std::exit(status);
+}
+
+// Parse the command line arguments
+static const options_t parse(const int &argc, char **const argv) {
+    options_t options;
+    options.format = "csv";
+    options.min_size = 1;
+    options.max_size = 10000000;
+    options.warmup = 1;
+    options.samples = 5;
+    options.sample_time = 0.05;
+    options.limit = 10;
+    options.workers = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if ((arg == "-h") || (arg == "--help"))
+            usage(0);
+
+        if (i + 1 == argc)
+            usage(1);
+
+        const std::string value = argv[++i];
+        if (arg == "--format")
+            options.format = value;
+        else if (arg == "--output")
+            options.output = value;
+        else if (arg == "--ops") {
+            std::size_t begin = 0;
+            while (begin <= value.size()) {
+                const std::size_t end = value.find(',', begin);
+                const std::size_t operation = std::find(names, names + operation_count, value.substr(begin, end - begin)) - names;
+                if (operation == operation_count)
+                    usage(1);
+
+                options.operations.push_back(static_cast<operation_t>(operation));
+                begin = end == std::string::npos ? end : end + 1;
+            }
+        }
+        else if (arg == "--min")
+            options.min_size = std::strtoul(value.c_str(), NULL, 10);
+        else if (arg == "--max")
+            options.max_size = std::strtoul(value.c_str(), NULL, 10);
+        else if (arg == "--warmup")
+            options.warmup = std::strtoul(value.c_str(), NULL, 10);
+        else if (arg == "--samples")
+            options.samples = std::strtoul(value.c_str(), NULL, 10);
+        else if (arg == "--sample-time")
+            options.sample_time = std::strtod(value.c_str(), NULL);
+        else if (arg == "--limit")
+            options.limit = std::strtod(value.c_str(), NULL);
+        else if (arg == "--workers")
+            options.workers = std::strtoul(value.c_str(), NULL, 10);
+        else
+            usage(1);
+    }
+
+    if (((options.format != "csv") && (options.format != "json")) || !options.min_size || !options.samples)
+        usage(1);
+
+    return options;
+}
+
+
+// Main
+
+int main(int argc, char **argv) {
+    const options_t options = parse(argc, argv);
+    bnl::set_workers(options.workers);
+    std::srand(1);
+
+    // All the operations by default
+    std::vector<operation_t> operations = options.operations;
+    if (operations.empty())
+        for (std::size_t i = 0; i < operation_count; i++)
+            operations.push_back(static_cast<operation_t>(i));
+
+    // Sizes from the smallest one, multiplied by 4 up to the largest one
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = options.min_size; size <= options.max_size; size <<= 2)
+        sizes.push_back(size);
+
+    if (sizes.empty() || (sizes.back() != options.max_size))
+        sizes.push_back(options.max_size);
+
+    std::vector<result_t> results;
+    std::vector<bool> skipped(operations.size(), false);
+    const std::size_t parse_index = std::find(operations.begin(), operations.end(), PARSE) - operations.begin();
+
+    for (std::size_t s = 0; s < sizes.size(); s++) {
+        // Nothing left to measure
+        if (std::find(skipped.begin(), skipped.end(), false) == skipped.end())
+            break;
+
+        operands_t n;
+        build(sizes[s], n, (parse_index < operations.size()) && !skipped[parse_index]);
+
+        for (std::size_t o = 0; o < operations.size(); o++) {
+            if (skipped[o])
+                continue;
+
+            const operation_t &operation = operations[o];
+
+            // Iterations of each sample from a single timed run
+            const double single = run(operation, n, 1);
+            std::size_t iterations = 1;
+            if (single < options.sample_time)
+                iterations = static_cast<std::size_t>(options.sample_time / (single > 1e-9 ? single : 1e-9)) + 1;
+
+            for (std::size_t i = 0; i < options.warmup; i++)
+                run(operation, n, iterations);
+
+            std::vector<double> times(options.samples);
+            for (std::size_t i = 0; i < options.samples; i++)
+                times[i] = run(operation, n, iterations) * 1e9 / iterations;
+
+            // Statistics of the samples
+            std::sort(times.begin(), times.end());
+            double total = 0;
+            for (std::size_t i = 0; i < times.size(); i++)
+                total += times[i];
+
+            const result_t result = {names[operation], sizes[s], iterations, times.front(), times[times.size() >> 1], total / times.size()};
+            results.push_back(result);
+            std::cerr << names[operation] << " " << sizes[s] << ": " << result.median << " ns" << std::endl;
+
+            // The larger sizes would take too long
+            if (single > options.limit)
+                skipped[o] = true;
+        }
+    }
+
+    // Write the results
+    std::ofstream file;
+    if (!options.output.empty()) {
+        file.open(options.output.c_str());
+        if (!file) {
+            std::cerr << "can't open " << options.output << std::endl;
+            return 1;
+        }
+    }
+
+    std::ostream &stream = options.output.empty() ? std::cout : file;
+    if (options.format == "csv")
+        csv(stream, results);
+    else
+        json(stream, results, options);
+
+    return 0;
+}
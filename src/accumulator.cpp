@@ -0,0 +1,103 @@
+#include "accumulator.hpp"
+
+
+// Constants
+
+// Additions between the carries propagation, each word has at most the sum of
+// this many data blocks, far lower than 2^64
+static const std::size_t max_pending = static_cast<std::size_t>(1) << 31;
+
+
+// Private static methods
+
+// Add the data blocks of a magnitude to a partial sum
+void bnl::accumulator::add(std::vector<bnl::ulint> &sum, const bnl::ulint *const data, const std::size_t &size) {
+    // The sum grows to the size of the value
+    if (sum.size() < size)
+        sum.resize(size, 0);
+
+    // Each data block is added to its own word, the carries are deferred
+    for (std::size_t i = 0; i < size; i++)
+        sum[i] += data[i];
+}
+
+// Propagate the deferred carries of a partial sum
+void bnl::accumulator::normalize(std::vector<bnl::ulint> &sum) {
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0; i < sum.size(); i++) {
+        const bnl::ulint block = sum[i] + carry;
+        sum[i] = block & bnl::integer::base_mask;
+        carry = block >> 32;
+    }
+
+    // Last carry
+    for (; carry; carry >>= 32)
+        sum.push_back(carry & bnl::integer::base_mask);
+}
+
+
+// Private methods
+
+// Count the additions, propagating the carries before the words can overflow
+void bnl::accumulator::count(const std::size_t &additions) {
+    if (pending + additions > max_pending) {
+        normalize(pos);
+        normalize(neg);
+        pending = 0;
+    }
+
+    pending += additions;
+}
+
+
+// Constructors
+
+// Empty sum
+bnl::accumulator::accumulator() : pos(1, 0), neg(1, 0), pending(0) {}
+
+
+// Methods
+
+// The sum of all the values added
+const bnl::integer bnl::accumulator::value() const {
+    // Partial sums with their carries propagated
+    std::vector<bnl::ulint> p = pos;
+    std::vector<bnl::ulint> n = neg;
+    normalize(p);
+    normalize(n);
+
+    return bnl::integer_view(&p[0], p.size()) - bnl::integer_view(&n[0], n.size());
+}
+
+// Remove all the values added
+void bnl::accumulator::clear() {
+    pos.assign(1, 0);
+    neg.assign(1, 0);
+    pending = 0;
+}
+
+
+// Assignment operators
+
+// Add a value
+bnl::accumulator &bnl::accumulator::operator += (const bnl::integer_view &n) {
+    count(1);
+    add(n.sign ? neg : pos, n.data, n.size);
+    return *this;
+}
+
+// Subtract a value
+bnl::accumulator &bnl::accumulator::operator -= (const bnl::integer_view &n) {
+    count(1);
+    add(n.sign ? pos : neg, n.data, n.size);
+    return *this;
+}
+
+// Add all the values of another sum, like the one of other thread
+bnl::accumulator &bnl::accumulator::operator += (const bnl::accumulator &a) {
+    // Each word of the other sum has at most its pending additions plus one
+    count(a.pending + 1);
+    add(pos, &a.pos[0], a.pos.size());
+    add(neg, &a.neg[0], a.neg.size());
+    return *this;
+}
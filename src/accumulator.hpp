@@ -0,0 +1,75 @@
+#ifndef __BNL_ACCUMULATOR_HPP_
+#define __BNL_ACCUMULATOR_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::integer_view
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Sum of many numbers with deferred carries. The positive and the negative
+    // values are added to separate partial sums, each data block in its own
+    // machine word, so adding a number only touches its own data blocks. The
+    // carries are propagated when the words could overflow, and the sum is
+    // built only when it is asked for
+    class accumulator {
+        private:
+            // Attributes
+
+            // Partial sums of the magnitudes of the positive and the negative
+            // values, a word of each data block with its deferred carries
+            std::vector<bnl::ulint> pos;
+            std::vector<bnl::ulint> neg;
+
+            // Additions since the carries were propagated
+            std::size_t pending;
+
+
+            // Static methods
+
+            // Add the data blocks of a magnitude to a partial sum
+            static void add(std::vector<bnl::ulint> &sum, const bnl::ulint *const data, const std::size_t &size);
+
+            // Propagate the deferred carries of a partial sum
+            static void normalize(std::vector<bnl::ulint> &sum);
+
+
+            // Methods
+
+            // Count the additions, propagating the carries before the words
+            // can overflow
+            void count(const std::size_t &additions);
+
+
+        public:
+            // Constructors
+
+            // Empty sum
+            accumulator();
+
+
+            // Methods
+
+            // The sum of all the values added
+            const bnl::integer value() const;
+
+            // Remove all the values added
+            void clear();
+
+
+            // Assignment operators
+
+            // Add a value
+            bnl::accumulator &operator += (const bnl::integer_view &n);
+
+            // Subtract a value
+            bnl::accumulator &operator -= (const bnl::integer_view &n);
+
+            // Add all the values of another sum, like the one of other thread
+            bnl::accumulator &operator += (const bnl::accumulator &a);
+    };
+}
+
+#endif // __BNL_ACCUMULATOR_HPP_
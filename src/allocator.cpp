@@ -0,0 +1,508 @@
+#include "allocator.hpp"
+#include "stats.hpp" // bnl::stat_malloc, bnl::stat_realloc, bnl::stat_free
+
+#include <cstdlib> // std::malloc, std::realloc, std::free
+#include <cstring> // std::memcpy, std::memset
+#include <new>     // std::bad_alloc
+
+#include <pthread.h> // pthread_key_t, pthread_key_create, pthread_once, pthread_setspecific
+
+
+// Sizes
+
+// Alignment of the blocks in bytes
+static const std::size_t alignment = 16;
+
+// Round up a size in bytes to the alignment
+static inline std::size_t align(const std::size_t &bytes) {
+    return (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+
+// Block header, placed before the memory returned by bnl::malloc
+struct header_t {
+    // Allocator that reserved the block, NULL for the standard heap
+    bnl::allocator *owner;
+
+    // Requested size in bytes
+    std::size_t bytes;
+
+    // Holders of the block, updated atomically
+    std::size_t holders;
+};
+
+// Block header size, keeping the block memory aligned. A constant expression,
+// so it is ready before the static numbers of any translation unit
+static const std::size_t header_size = (sizeof(header_t) + alignment - 1) & ~(alignment - 1);
+
+// Largest size in bytes of a block, so the size with its header doesn't overflow
+static const std::size_t max_bytes = static_cast<std::size_t>(-1) - header_size;
+
+// Block header of the memory returned by bnl::malloc
+static inline header_t *header(void *const ptr) {
+    return reinterpret_cast<header_t *>(static_cast<char *>(ptr) - header_size);
+}
+
+// Holders of a block, read atomically
+static inline std::size_t holders(header_t *const block) {
+    return __sync_fetch_and_add(&block->holders, 0);
+}
+
+
+// Standard heap
+
+// Allocator over std::malloc, std::realloc and std::free
+struct heap_t : public bnl::allocator {
+    // Reserve the given bytes
+    void *allocate(const std::size_t &bytes) {
+        return std::malloc(bytes);
+    }
+
+    // Resize a block preserving its content
+    void *reallocate(void *const ptr, const std::size_t &, const std::size_t &new_bytes) {
+        return std::realloc(ptr, new_bytes);
+    }
+
+    // Release a block
+    void deallocate(void *const ptr, const std::size_t &) {
+        std::free(ptr);
+    }
+};
+
+// The standard heap, built on its first use so it is ready for the static
+// numbers of any translation unit and destroyed after them
+static bnl::allocator &heap() {
+    static heap_t instance;
+    return instance;
+}
+
+
+// Allocators selection
+
+// Process global allocator, NULL for the standard heap
+static bnl::allocator *global_allocator = NULL;
+
+// Allocator of each thread, NULL for the global allocator
+static __thread bnl::allocator *thread_allocator = NULL;
+
+
+// Scope
+
+// Set the allocator of the calling thread
+bnl::allocator::scope::scope(bnl::allocator &a) : previous(thread_allocator) {
+    thread_allocator = &a;
+}
+
+// Restore the previous allocator of the calling thread
+bnl::allocator::scope::~scope() {
+    thread_allocator = previous;
+}
+
+
+// Allocator
+
+// The allocator of the calling thread, or the global allocator
+bnl::allocator &bnl::allocator::current() {
+    return thread_allocator ? *thread_allocator : bnl::allocator::global();
+}
+
+// The process global allocator, the standard heap by default
+bnl::allocator &bnl::allocator::global() {
+    return global_allocator ? *global_allocator : heap();
+}
+
+// Set the process global allocator, NULL restores the standard heap
+void bnl::allocator::global(bnl::allocator *const a) {
+    global_allocator = a;
+}
+
+// Destructor
+bnl::allocator::~allocator() {}
+
+
+// Arena
+
+// Memory of a chunk, after its header keeping the alignment
+char *bnl::arena::memory(chunk_t *const chunk) {
+    return reinterpret_cast<char *>(chunk) + align(sizeof(chunk_t));
+}
+
+// Empty arena reserving chunks of at least the given bytes
+bnl::arena::arena(const std::size_t &bytes) : head(NULL), chunk_size(align(bytes ? bytes : alignment)), last(NULL) {}
+
+// Release all the chunks
+bnl::arena::~arena() {
+    while (head) {
+        chunk_t *const next = head->next;
+        std::free(head);
+        head = next;
+    }
+}
+
+// Add a chunk with at least the given bytes
+void bnl::arena::grow(const std::size_t &bytes) {
+    const std::size_t size = bytes > chunk_size ? bytes : chunk_size;
+    chunk_t *const chunk = static_cast<chunk_t *>(std::malloc(align(sizeof(chunk_t)) + size));
+    if (!chunk)
+        return;
+
+    chunk->next = head;
+    chunk->size = size;
+    chunk->used = 0;
+    head = chunk;
+}
+
+// Release all the blocks, keeping a single chunk as large as all the previous
+// chunks together
+void bnl::arena::reset() {
+    last = NULL;
+
+    // Single chunk
+    if (!head || !head->next) {
+        if (head)
+            head->used = 0;
+
+        return;
+    }
+
+    // Merge the chunks, so the next cycle needs no more chunks
+    const std::size_t total = capacity();
+    while (head) {
+        chunk_t *const next = head->next;
+        std::free(head);
+        head = next;
+    }
+
+    grow(total);
+}
+
+// Bytes reserved from the system
+std::size_t bnl::arena::capacity() const {
+    std::size_t ans = 0;
+    for (const chunk_t *chunk = head; chunk; chunk = chunk->next)
+        ans += chunk->size;
+
+    return ans;
+}
+
+// Bytes of the reserved blocks
+std::size_t bnl::arena::used() const {
+    std::size_t ans = 0;
+    for (const chunk_t *chunk = head; chunk; chunk = chunk->next)
+        ans += chunk->used;
+
+    return ans;
+}
+
+// Reserve the given bytes, aligned to 16 bytes
+void *bnl::arena::allocate(const std::size_t &bytes) {
+    const std::size_t size = align(bytes);
+
+    // New chunk
+    if (!head || (head->size - head->used < size)) {
+        const chunk_t *const old = head;
+        grow(size);
+
+        if (head == old)
+            return NULL;
+    }
+
+    last = memory(head) + head->used;
+    head->used += size;
+
+    return last;
+}
+
+// Resize a block, in place if it is the last one
+void *bnl::arena::reallocate(void *const ptr, const std::size_t &old_bytes, const std::size_t &new_bytes) {
+    const std::size_t size = align(new_bytes);
+
+    // The last block grows or shrinks in place if it fits in its chunk
+    if (ptr == last) {
+        const std::size_t offset = static_cast<char *>(ptr) - memory(head);
+        if (offset + size <= head->size) {
+            head->used = offset + size;
+            return ptr;
+        }
+    }
+
+    // Other blocks keep their memory when shrinking
+    else if (size <= align(old_bytes))
+        return ptr;
+
+    // Move the block
+    void *const ans = allocate(new_bytes);
+    if (ans)
+        std::memcpy(ans, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+
+    return ans;
+}
+
+// Release a block, only recovered if it is the last one
+void bnl::arena::deallocate(void *const ptr, const std::size_t &) {
+    if (ptr == last) {
+        head->used = static_cast<char *>(ptr) - memory(head);
+        last = NULL;
+    }
+}
+
+
+// Scratch memory
+
+// Scratch memory stack of each thread
+struct stack_t {
+    // Stack memory
+    char *memory;
+
+    // Stack memory size in bytes
+    std::size_t capacity;
+
+    // Bytes of the frames in the stack memory
+    std::size_t top;
+
+    // Bytes of all the frames, including the heap ones
+    std::size_t used;
+
+    // Largest bytes of all the frames since the stack was resized
+    std::size_t peak;
+};
+
+// Scratch memory stack of each thread, empty at the beginning
+static __thread stack_t stack;
+
+// Thread specific key that releases the stack when the thread exits
+static pthread_key_t stack_key;
+static pthread_once_t stack_once = PTHREAD_ONCE_INIT;
+
+// Release the stack of the exiting thread
+static void release_stack(void *) {
+    bnl::scratch::release();
+}
+
+// Create the thread specific key
+static void create_stack_key() {
+    pthread_key_create(&stack_key, release_stack);
+}
+
+// Reserve a frame of the given data blocks
+bnl::scratch::scratch(const std::size_t &blocks) : memory(NULL), bytes(align((blocks ? blocks : 1) * bnl::ulint_size)), heap(false) {
+    stack.used += bytes;
+    if (stack.used > stack.peak)
+        stack.peak = stack.used;
+
+    // Frame on the top of the stack
+    if (stack.top + bytes <= stack.capacity) {
+        memory = reinterpret_cast<bnl::ulint *>(stack.memory + stack.top);
+        stack.top += bytes;
+        return;
+    }
+
+    // Frame reserved from the heap
+    memory = static_cast<bnl::ulint *>(std::malloc(bytes));
+    heap = true;
+
+    if (!memory) {
+        stack.used -= bytes;
+        throw std::bad_alloc();
+    }
+}
+
+// Release the frame, the stack grows to the high water mark when it is empty
+bnl::scratch::~scratch() {
+    stack.used -= bytes;
+
+    if (heap)
+        std::free(memory);
+    else
+        stack.top -= bytes;
+
+    if (!stack.used && (stack.peak > stack.capacity)) {
+        std::free(stack.memory);
+        stack.memory = static_cast<char *>(std::malloc(stack.peak));
+        stack.capacity = stack.memory ? stack.peak : 0;
+
+        // Release the stack when the thread exits
+        pthread_once(&stack_once, create_stack_key);
+        pthread_setspecific(stack_key, &stack);
+    }
+}
+
+// Size in bytes of the stack of the calling thread
+std::size_t bnl::scratch::capacity() {
+    return stack.capacity;
+}
+
+// Release the stack of the calling thread, that must be empty
+void bnl::scratch::release() {
+    if (stack.used)
+        return;
+
+    std::free(stack.memory);
+    stack.memory = NULL;
+    stack.capacity = 0;
+    stack.peak = 0;
+}
+
+
+// Memory functions
+
+// Reserve the given bytes with the given allocator, the standard heap is called
+// directly
+static void *reserve(bnl::allocator *const owner, const std::size_t &bytes) {
+    if (bytes > max_bytes)
+        return NULL;
+
+    header_t *const block = static_cast<header_t *>(owner ? owner->allocate(header_size + bytes) : std::malloc(header_size + bytes));
+    if (!block)
+        return NULL;
+
+    block->owner = owner;
+    block->bytes = bytes;
+    block->holders = 1;
+
+#ifdef BNL_STATS
+    bnl::stat_malloc(bytes);
+#endif
+
+    return reinterpret_cast<char *>(block) + header_size;
+}
+
+// Copy of a block reserved by the given allocator, resized to the given bytes
+static void *copy(bnl::allocator *const owner, void *const ptr, const std::size_t &bytes) {
+    void *const ans = reserve(owner, bytes);
+    if (ans) {
+        const std::size_t old_bytes = header(ptr)->bytes;
+        std::memcpy(ans, ptr, old_bytes < bytes ? old_bytes : bytes);
+    }
+
+    return ans;
+}
+
+// Allocator of the calling thread
+static inline bnl::allocator *current() {
+    return thread_allocator ? thread_allocator : global_allocator;
+}
+
+// Reserve the given bytes with the allocator of the calling thread
+void *bnl::malloc(const std::size_t &bytes) {
+    return reserve(current(), bytes);
+}
+
+// Reserve an array filled with zeros
+void *bnl::calloc(const std::size_t &count, const std::size_t &size) {
+    // Check the size of the array
+    if (size && (count > static_cast<std::size_t>(-1) / size))
+        return NULL;
+
+    const std::size_t bytes = count * size;
+    void *const ans = bnl::malloc(bytes);
+    if (ans)
+        std::memset(ans, 0, bytes);
+
+    return ans;
+}
+
+// Resize a block with the allocator that reserved it, the other holders of a
+// shared block keep the previous one
+void *bnl::realloc(void *const ptr, const std::size_t &bytes) {
+    if (!ptr)
+        return bnl::malloc(bytes);
+
+    if (bytes > max_bytes)
+        return NULL;
+
+    header_t *const old = header(ptr);
+    bnl::allocator *const owner = old->owner;
+    if (holders(old) > 1) {
+        void *const ans = copy(owner, ptr, bytes);
+        if (ans)
+            bnl::free(ptr);
+
+        return ans;
+    }
+
+    const std::size_t old_bytes = old->bytes;
+    header_t *const block = static_cast<header_t *>(owner ? owner->reallocate(old, header_size + old_bytes, header_size + bytes) : std::realloc(old, header_size + bytes));
+    if (!block)
+        return NULL;
+
+    block->owner = owner;
+    block->bytes = bytes;
+
+#ifdef BNL_STATS
+    bnl::stat_realloc(old_bytes, bytes);
+#endif
+
+    return reinterpret_cast<char *>(block) + header_size;
+}
+
+// Release a block with the allocator that reserved it when its last holder
+// releases it
+void bnl::free(void *const ptr) {
+    if (!ptr)
+        return;
+
+    header_t *const block = header(ptr);
+    if (__sync_sub_and_fetch(&block->holders, 1))
+        return;
+
+#ifdef BNL_STATS
+    bnl::stat_free();
+#endif
+
+    if (block->owner)
+        block->owner->deallocate(block, header_size + block->bytes);
+    else
+        std::free(block);
+}
+
+
+// Block sharing
+
+// Another holder of a block, copied if it belongs to another allocator than the
+// one of the calling thread
+void *bnl::share(void *const ptr) {
+    header_t *const block = header(ptr);
+    bnl::allocator *const owner = current();
+    if (block->owner != owner)
+        return copy(owner, ptr, block->bytes);
+
+    __sync_fetch_and_add(&block->holders, 1);
+    return ptr;
+}
+
+// Replace the block of a holder by another block
+void *bnl::assign(void *const dest, void *const src) {
+    if (dest == src)
+        return dest;
+
+    // No previous block, like a new holder
+    if (!dest)
+        return bnl::share(src);
+
+    // Shared with the same allocator
+    header_t *const block = header(src);
+    if (header(dest)->owner == block->owner) {
+        __sync_fetch_and_add(&block->holders, 1);
+        bnl::free(dest);
+        return src;
+    }
+
+    // Copied over the block of the holder
+    void *const ans = bnl::realloc(dest, block->bytes);
+    if (ans)
+        std::memcpy(ans, src, block->bytes);
+
+    return ans;
+}
+
+// The block with a single holder, copied with its allocator if it is shared
+void *bnl::unshare(void *const ptr) {
+    header_t *const block = header(ptr);
+    return holders(block) > 1 ? bnl::realloc(ptr, block->bytes) : ptr;
+}
+
+// Whether a block has more than one holder
+bool bnl::shared(const void *const ptr) {
+    return holders(header(const_cast<void *>(ptr))) > 1;
+}
@@ -0,0 +1,253 @@
+#ifndef __BNL_ALLOCATOR_HPP_
+#define __BNL_ALLOCATOR_HPP_
+
+#include "bnl.hpp" // bnl::ulint, bnl::ulint_size
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Memory source of the numeric data. Each block remembers the allocator
+    // that reserved it, so it is always released by the same allocator, which
+    // must outlive all of its blocks
+    class allocator {
+        public:
+            // Scope that sets the allocator of the calling thread, restoring
+            // the previous one when destroyed
+            class scope {
+                private:
+                    // Attributes
+
+                    // Allocator of the thread before the scope
+                    bnl::allocator *previous;
+
+
+                    // Constructors
+
+                    // Copy constructor, not allowed
+                    scope(const bnl::allocator::scope &s);
+
+
+                    // Assignment operators
+
+                    // Direct assignation, not allowed
+                    bnl::allocator::scope &operator = (const bnl::allocator::scope &s);
+
+
+                public:
+                    // Constructors
+
+                    // Set the allocator of the calling thread
+                    explicit scope(bnl::allocator &a);
+
+
+                    // Destructor
+                    ~scope();
+            };
+
+
+            // Static methods
+
+            // The allocator of the calling thread, or the global allocator
+            static bnl::allocator &current();
+
+            // The process global allocator, the standard heap by default
+            static bnl::allocator &global();
+
+            // Set the process global allocator, NULL restores the standard heap
+            static void global(bnl::allocator *const a);
+
+
+            // Methods
+
+            // Reserve the given bytes, aligned to 16 bytes
+            virtual void *allocate(const std::size_t &bytes) = 0;
+
+            // Resize a block of this allocator preserving its content
+            virtual void *reallocate(void *const ptr, const std::size_t &old_bytes, const std::size_t &new_bytes) = 0;
+
+            // Release a block of this allocator
+            virtual void deallocate(void *const ptr, const std::size_t &bytes) = 0;
+
+
+            // Destructor
+            virtual ~allocator();
+    };
+
+
+    // Bump allocator over a list of memory chunks. Releasing a block only
+    // recovers its memory if it was the last one reserved, everything else is
+    // released at once with reset. It is not thread safe, each thread should
+    // use its own arena
+    class arena : public bnl::allocator {
+        private:
+            // Memory chunk header, followed by the chunk memory
+            struct chunk_t {
+                // Previous chunk
+                chunk_t *next;
+
+                // Chunk memory size
+                std::size_t size;
+
+                // Used bytes of the chunk memory
+                std::size_t used;
+            };
+
+
+            // Attributes
+
+            // Chunk where the blocks are reserved, the newest one
+            chunk_t *head;
+
+            // Minimum chunk memory size
+            std::size_t chunk_size;
+
+            // Last reserved block, the only one that can grow in place
+            void *last;
+
+
+            // Constructors
+
+            // Copy constructor, not allowed
+            arena(const bnl::arena &a);
+
+
+            // Static methods
+
+            // Memory of a chunk, after its header keeping the alignment
+            static char *memory(chunk_t *const chunk);
+
+
+            // Methods
+
+            // Add a chunk with at least the given bytes
+            void grow(const std::size_t &bytes);
+
+
+            // Assignment operators
+
+            // Direct assignation, not allowed
+            bnl::arena &operator = (const bnl::arena &a);
+
+
+        public:
+            // Constructors
+
+            // Empty arena reserving chunks of at least the given bytes
+            explicit arena(const std::size_t &bytes = 65536);
+
+
+            // Destructor
+            ~arena();
+
+
+            // Methods
+
+            // Release all the blocks, keeping a single chunk as large as all
+            // the previous chunks together
+            void reset();
+
+            // Bytes reserved from the system
+            std::size_t capacity() const;
+
+            // Bytes of the reserved blocks
+            std::size_t used() const;
+
+            // Reserve the given bytes, aligned to 16 bytes
+            void *allocate(const std::size_t &bytes);
+
+            // Resize a block, in place if it is the last one
+            void *reallocate(void *const ptr, const std::size_t &old_bytes, const std::size_t &new_bytes);
+
+            // Release a block, only recovered if it is the last one
+            void deallocate(void *const ptr, const std::size_t &bytes);
+    };
+
+
+    // Frame of the scratch memory stack of the calling thread, released when
+    // destroyed. Frames are released in reverse order, so the stack grows to
+    // the high water mark of the thread and the kernels reserve no memory once
+    // it is reached. A frame that doesn't fit is reserved from the heap, and
+    // the stack grows to the high water mark when it is empty again
+    class scratch {
+        private:
+            // Attributes
+
+            // Frame memory
+            bnl::ulint *memory;
+
+            // Frame size in bytes
+            std::size_t bytes;
+
+            // Whether the frame was reserved from the heap
+            bool heap;
+
+
+            // Constructors
+
+            // Copy constructor, not allowed
+            scratch(const bnl::scratch &s);
+
+
+            // Assignment operators
+
+            // Direct assignation, not allowed
+            bnl::scratch &operator = (const bnl::scratch &s);
+
+
+        public:
+            // Constructors
+
+            // Reserve a frame of the given data blocks
+            explicit scratch(const std::size_t &blocks);
+
+
+            // Destructor
+            ~scratch();
+
+
+            // Static methods
+
+            // Size in bytes of the stack of the calling thread
+            static std::size_t capacity();
+
+            // Release the stack of the calling thread, that must be empty
+            static void release();
+
+
+            // Methods
+
+            // Frame memory
+            inline bnl::ulint *data() const {
+                return memory;
+            }
+    };
+
+
+    // Numeric data memory functions, with the semantics of the standard ones,
+    // through the allocator of the calling thread. The blocks count their
+    // holders, they are released by the last one and copied before they are
+    // resized while they are shared
+    void *malloc(const std::size_t &bytes);
+    void *calloc(const std::size_t &count, const std::size_t &size);
+    void *realloc(void *const ptr, const std::size_t &bytes);
+    void free(void *const ptr);
+
+    // Another holder of a block, the same block if it was reserved by the
+    // allocator of the calling thread, or a copy reserved by it otherwise
+    void *share(void *const ptr);
+
+    // Replace the block of a holder by another block, shared if both were
+    // reserved by the same allocator, or copied over the resized block of the
+    // holder otherwise
+    void *assign(void *const dest, void *const src);
+
+    // The block with a single holder, copied if it is shared, to modify it
+    void *unshare(void *const ptr);
+
+    // Whether a block has more than one holder
+    bool shared(const void *const ptr);
+}
+
+#endif // __BNL_ALLOCATOR_HPP_
@@ -0,0 +1,187 @@
+#include "barrett.hpp"
+#include "gcd.hpp" // bnl::invert
+
+#include <stdexcept> // std::invalid_argument
+
+
+// Private static methods
+
+// The product without the n lowest data blocks, ignoring the partial products
+// lower than base^(n - 2), so at most one unit smaller than the real one
+const bnl::integer bnl::barrett::mulhigh(const bnl::integer_view &a, const bnl::integer_view &b, const std::size_t &blocks) {
+    // Underflow
+    const std::size_t size = a.size + b.size;
+    if (size <= blocks)
+        return bnl::integer::zero;
+
+    // Lowest partial product to compute
+    const std::size_t first = blocks > 2 ? blocks - 2 : 0;
+    bnl::integer prod(size, false);
+    bnl::ulint *const prod_data = prod.data;
+
+    // Multiply and accumulate each row from the lowest needed column
+    for (std::size_t i = 0; i < a.size; i++) {
+        const bnl::ulint block = a.data[i];
+        bnl::ulint carry = 0;
+
+        if (!block)
+            continue;
+
+        std::size_t j = first > i ? first - i : 0;
+        for (; j < b.size; j++) {
+            const bnl::ulint tmp = b.data[j] * block + prod_data[i + j] + carry;
+            prod_data[i + j] = tmp & bnl::integer::base_mask;
+            carry = tmp >> 32;
+        }
+
+        prod_data[i + b.size] = carry;
+    }
+
+    // Shrink and return the highest blocks
+    prod.shrink();
+    return bnl::integer(bnl::integer_view(prod).high(blocks));
+}
+
+// The n lowest data blocks of the product
+const bnl::integer bnl::barrett::mullow(const bnl::integer_view &a, const bnl::integer_view &b, const std::size_t &blocks) {
+    bnl::integer ans(blocks, false);
+    bnl::ulint *const ans_data = ans.data;
+
+    // Multiply and accumulate each row up to the highest needed column
+    for (std::size_t i = 0; (i < a.size) && (i < blocks); i++) {
+        const bnl::ulint block = a.data[i];
+        bnl::ulint carry = 0;
+
+        if (!block)
+            continue;
+
+        std::size_t j = 0;
+        for (; (j < b.size) && (i + j < blocks); j++) {
+            const bnl::ulint tmp = b.data[j] * block + ans_data[i + j] + carry;
+            ans_data[i + j] = tmp & bnl::integer::base_mask;
+            carry = tmp >> 32;
+        }
+
+        if (i + j < blocks)
+            ans_data[i + j] = carry;
+    }
+
+    // Shrink and return the answer
+    ans.shrink();
+    return ans;
+}
+
+
+// Constructors
+
+// Constructor from modulus
+bnl::barrett::barrett(const bnl::integer &n) : m(bnl::abs(n)), mu(), k(m.size) {
+    // Check the modulus
+    if (bnl::iszero(m))
+        throw std::invalid_argument("can't build bnl::barrett: modulus is zero");
+
+    // Reciprocal of the modulus
+    bnl::integer pow(2 * k + 1, false);
+    pow.data[2 * k] = 1;
+    mu = bnl::integer::div(pow, m).quot;
+}
+
+
+// Methods
+
+// Remainder of the division by the modulus, without division if |n| < base^(2k)
+const bnl::integer bnl::barrett::reduce(const bnl::integer &n) const {
+    // Out of the context range
+    if (n.size > k << 1)
+        return bnl::integer::div(n, m).rem;
+
+    // Already reduced
+    if (bnl::integer::cmpabs(n, m) < 0)
+        return n;
+
+
+    // Quotient estimation, at most three units smaller than the real quotient
+    const bnl::integer q = bnl::barrett::mulhigh(bnl::integer_view(n).high(k - 1), mu, k + 1);
+
+    // Remainder estimation modulo base^(k + 1), the lowest blocks are a view
+    // of the dividend
+    const bnl::integer_view r1 = bnl::integer_view(n).low(k + 1);
+    const bnl::integer r2 = bnl::barrett::mullow(q, m, k + 1);
+    bnl::integer ans(k + 1, false);
+
+    // Subtraction modulo base^(k + 1)
+    bnl::ulint borrow = 0;
+    for (std::size_t i = 0; i <= k; i++) {
+        const bnl::ulint a = i < r1.size ? r1.data[i] : 0;
+        const bnl::ulint b = i < r2.size ? r2.data[i] : 0;
+        const bnl::ulint diff = a - b - borrow;
+        borrow = diff >> 63;
+        ans.data[i] = diff & bnl::integer::base_mask;
+    }
+
+    ans.shrink();
+
+
+    // Final corrections
+    while (bnl::integer::cmpabs(ans, m) >= 0)
+        ans = ans - m;
+
+    // Set the dividend sign and return the answer
+    ans.sign = n.sign && !bnl::iszero(ans);
+    return ans;
+}
+
+// The given number raised to the given exponent modulo the modulus, in [0, m)
+const bnl::integer bnl::barrett::pow(const bnl::integer &a, const bnl::integer &e) const {
+    // Negative exponent
+    if (e.sign)
+        return pow(bnl::invert(a, m), -e);
+
+    // Unit modulus
+    if (bnl::isone(m))
+        return bnl::integer::zero;
+
+    // Zero exponent
+    if (bnl::iszero(e))
+        return bnl::integer::one;
+
+
+    // Least positive representative of the base
+    bnl::integer base = reduce(a);
+    if (base.sign)
+        base += m;
+
+    // Powers of the base for each window of 4 bits
+    bnl::integer table[16];
+    table[1] = base;
+    for (std::size_t i = 2; i < 16; i++)
+        table[i] = reduce(table[i - 1] * base);
+
+
+    // Fixed window exponentiation from the most significative window, the
+    // windows never cross the data blocks
+    const std::size_t windows = (e.precision() + 3) >> 2;
+    bnl::integer ans = bnl::integer::one;
+
+    for (std::size_t i = windows - 1; i < windows; i--) {
+        // Raise to the 16th power
+        if (i < windows - 1)
+            for (std::size_t j = 0; j < 4; j++)
+                ans = reduce(ans * ans);
+
+        // Multiply by the window power
+        const bnl::ulint window = (e.data[i >> 3] >> ((i & 7) << 2)) & 15;
+        if (window)
+            ans = i < windows - 1 ? reduce(ans * table[window]) : table[window];
+    }
+
+    return ans;
+}
+
+
+// Functions
+
+// Modular exponentiation
+const bnl::integer bnl::powmod(const bnl::integer &a, const bnl::integer &e, const bnl::integer &m) {
+    return bnl::barrett(m).pow(a, e);
+}
@@ -0,0 +1,78 @@
+#ifndef __BNL_BARRETT_HPP_
+#define __BNL_BARRETT_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::integer_view
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Barrett reduction context
+    class barrett {
+        private:
+            // Attributes
+
+            // Modulus magnitude
+            bnl::integer m;
+
+            // Precomputed reciprocal floor(base^(2k) / m)
+            bnl::integer mu;
+
+            // Modulus size in data blocks
+            std::size_t k;
+
+
+            // Static methods
+
+            // The product without the n lowest data blocks, ignoring the partial products lower than base^(n - 2)
+            static const bnl::integer mulhigh(const bnl::integer_view &a, const bnl::integer_view &b, const std::size_t &blocks);
+
+            // The n lowest data blocks of the product
+            static const bnl::integer mullow(const bnl::integer_view &a, const bnl::integer_view &b, const std::size_t &blocks);
+
+
+        public:
+            // Constructors
+
+            // Constructor from modulus
+            barrett(const bnl::integer &n);
+
+
+            // Methods
+
+            // The modulus of the context
+            inline const bnl::integer &modulus() const {
+                return m;
+            }
+
+            // Remainder of the division by the modulus, without division if |n| < base^(2k)
+            const bnl::integer reduce(const bnl::integer &n) const;
+
+            // The given number raised to the given exponent modulo the modulus, in [0, m)
+            const bnl::integer pow(const bnl::integer &a, const bnl::integer &e) const;
+    };
+
+
+    // Modular exponentiation
+    const bnl::integer powmod(const bnl::integer &a, const bnl::integer &e, const bnl::integer &m);
+}
+
+
+// Arithmetic operators
+
+// Modulo with the cached modulus
+inline const bnl::integer operator % (const bnl::integer &a, const bnl::barrett &m) {
+    return m.reduce(a);
+}
+
+
+// Assignment operators
+
+// Assignation by modulo with the cached modulus
+inline bnl::integer &operator %= (bnl::integer &a, const bnl::barrett &m) {
+    return a = m.reduce(a);
+}
+
+
+#endif // __BNL_BARRETT_HPP_
@@ -0,0 +1,334 @@
+#include "batch.hpp"
+#include "mpn.hpp"      // bnl::mpn
+#include "parallel.hpp" // bnl::parallel, bnl::is_parallel, bnl::workers, bnl::task_t
+
+#include <algorithm> // std::swap
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+
+// Workers tasks
+
+// Sums of a slice of the batch, run by a worker. The numbers reserved by the
+// tasks come from the global allocator, the running thread may be waiting with
+// the scoped allocator of another computation
+struct add_t {
+    // Operands, the second one is a constant if each isn't set
+    const bnl::integer *a;
+    const bnl::integer *b;
+    bool each;
+
+    // Answers and their count
+    bnl::integer *ans;
+    std::size_t count;
+
+    // Run the slice
+    static void run(void *const arg) {
+        const bnl::allocator::scope scope(bnl::allocator::global());
+        const add_t &args = *static_cast<const add_t *>(arg);
+
+        for (std::size_t i = 0; i < args.count; i++)
+            bnl::batch_add(args.a + i, args.each ? args.b[i] : *args.b, args.ans + i, 1);
+    }
+};
+
+// Products of a slice of the batch, run by a worker
+struct mul_scalar_t {
+    // Operands
+    const bnl::integer *a;
+    bnl::lint k;
+
+    // Answers and their count
+    bnl::integer *ans;
+    std::size_t count;
+
+    // Run the slice
+    static void run(void *const arg) {
+        const bnl::allocator::scope scope(bnl::allocator::global());
+        const mul_scalar_t &args = *static_cast<const mul_scalar_t *>(arg);
+
+        for (std::size_t i = 0; i < args.count; i++)
+            bnl::batch_mul_scalar(args.a + i, args.k, args.ans + i, 1);
+    }
+};
+
+// Remainders of a slice of the batch, run by a worker
+struct mod_t {
+    // Operands
+    const bnl::integer *a;
+    const bnl::barrett *m;
+
+    // Answers and their count
+    bnl::integer *ans;
+    std::size_t count;
+
+    // Run the slice
+    static void run(void *const arg) {
+        const bnl::allocator::scope scope(bnl::allocator::global());
+        const mod_t &args = *static_cast<const mod_t *>(arg);
+
+        for (std::size_t i = 0; i < args.count; i++)
+            bnl::batch_mod(args.a + i, *args.m, args.ans + i, 1);
+    }
+};
+
+// First index of each slice of a batch split between the workers, followed by
+// the batch size. Slices have about the same size in bits, and there are none
+// if the batch isn't large enough
+static const std::vector<std::size_t> slices(const bnl::integer *const n, const std::size_t &count) {
+    std::vector<std::size_t> ans;
+    if ((count < 2) || (bnl::workers() < 2))
+        return ans;
+
+    // Total size of the numbers, zeros have no precision
+    std::vector<std::size_t> bits(count, 0);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        if (!bnl::iszero(n[i]))
+            bits[i] = bnl::integer::precision(n[i]);
+
+        total += bits[i];
+    }
+
+    if (!bnl::is_parallel(total >> 5))
+        return ans;
+
+    // Cut the batch each time the accumulated size reaches the next part
+    const std::size_t parts = bnl::workers() < count ? bnl::workers() : count;
+    std::size_t sum = 0;
+
+    ans.push_back(0);
+    for (std::size_t i = 0; i < count - 1; i++) {
+        sum += bits[i];
+        if (sum * parts >= total * ans.size())
+            ans.push_back(i + 1);
+    }
+
+    ans.push_back(count);
+    return ans;
+}
+
+
+// Private static methods
+
+// Sum written over the numeric data of the answer, that may be one of the
+// operands
+void bnl::integer::addto(const bnl::integer &a, const bnl::integer &b, bnl::integer &ans) {
+    // The larger magnitude first, added or subtracted by the other one
+    const bool add = a.sign == b.sign;
+    const bnl::integer &m = (add ? a.size >= b.size : bnl::integer::cmpabs(a, b) >= 0) ? a : b;
+    const bnl::integer &n = &m == &a ? b : a;
+
+    // Read before the answer is resized, it may be one of the operands
+    const std::size_t m_size = m.size;
+    const std::size_t n_size = n.size;
+    const bool sign = m.sign;
+
+    if (ans.size <= m_size)
+        ans.data = static_cast<bnl::ulint *>(bnl::realloc(ans.data, (m_size + 1) * bnl::ulint_size));
+    else
+        ans.unshare();
+
+    // Each block is read before it is written
+    bnl::ulint *const r = ans.data;
+    const bnl::ulint *const x = m.data;
+    const bnl::ulint *const y = n.data;
+
+    if (add)
+        r[m_size] = bnl::mpn::add(r, x, m_size, y, n_size);
+    else {
+        bnl::mpn::sub(r, x, m_size, y, n_size);
+        r[m_size] = 0;
+    }
+
+    // Shrink the answer, fixing the sign of zero
+    ans.size = m_size + 1;
+    ans.sign = sign;
+    ans.shrink();
+}
+
+
+// Batch arithmetic functions
+
+// Sum of each number and a constant, that isn't one of the answers
+void bnl::batch_add(const bnl::integer *const a, const bnl::integer &b, bnl::integer *const ans, const std::size_t &count) {
+    // Slices run by the workers if the batch is large enough
+    const std::vector<std::size_t> parts = slices(a, count);
+    if (!parts.empty()) {
+        std::vector<add_t> args(parts.size() - 1);
+        std::vector<bnl::task_t> tasks(parts.size() - 1);
+        for (std::size_t i = 0; i < args.size(); i++) {
+            const add_t slice = {a + parts[i], &b, false, ans + parts[i], parts[i + 1] - parts[i]};
+            const bnl::task_t task = {add_t::run, &args[i]};
+            args[i] = slice;
+            tasks[i] = task;
+        }
+
+        bnl::parallel(&tasks[0], tasks.size());
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+        bnl::integer::addto(a[i], b, ans[i]);
+}
+
+// Sum of the numbers of the same index
+void bnl::batch_add(const bnl::integer *const a, const bnl::integer *const b, bnl::integer *const ans, const std::size_t &count) {
+    // Slices run by the workers if the batch is large enough
+    const std::vector<std::size_t> parts = slices(a, count);
+    if (!parts.empty()) {
+        std::vector<add_t> args(parts.size() - 1);
+        std::vector<bnl::task_t> tasks(parts.size() - 1);
+        for (std::size_t i = 0; i < args.size(); i++) {
+            const add_t slice = {a + parts[i], b + parts[i], true, ans + parts[i], parts[i + 1] - parts[i]};
+            const bnl::task_t task = {add_t::run, &args[i]};
+            args[i] = slice;
+            tasks[i] = task;
+        }
+
+        bnl::parallel(&tasks[0], tasks.size());
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+        bnl::integer::addto(a[i], b[i], ans[i]);
+}
+
+// Product of each number by a machine word
+void bnl::batch_mul_scalar(const bnl::integer *const a, const bnl::lint &k, bnl::integer *const ans, const std::size_t &count) {
+    // Slices run by the workers if the batch is large enough
+    const std::vector<std::size_t> parts = slices(a, count);
+    if (!parts.empty()) {
+        std::vector<mul_scalar_t> args(parts.size() - 1);
+        std::vector<bnl::task_t> tasks(parts.size() - 1);
+        for (std::size_t i = 0; i < args.size(); i++) {
+            const mul_scalar_t slice = {a + parts[i], k, ans + parts[i], parts[i + 1] - parts[i]};
+            const bnl::task_t task = {mul_scalar_t::run, &args[i]};
+            args[i] = slice;
+            tasks[i] = task;
+        }
+
+        bnl::parallel(&tasks[0], tasks.size());
+        return;
+    }
+
+    // Magnitude of the scalar split in two data blocks, the highest one not
+    // larger than 2^31
+    const bnl::ulint scalar = k < 0 ? -static_cast<bnl::ulint>(k) : static_cast<bnl::ulint>(k);
+    const bnl::ulint low = scalar & bnl::integer::base_mask;
+    const bnl::ulint high = scalar >> 32;
+
+    for (std::size_t i = 0; i < count; i++) {
+        bnl::integer &r = ans[i];
+        const bnl::integer &n = a[i];
+
+        // Read before the answer is resized, it may be the operand
+        const std::size_t size = n.size;
+        const bool sign = n.sign != (k < 0);
+
+        if (r.size < size + 2)
+            r.data = static_cast<bnl::ulint *>(bnl::realloc(r.data, (size + 2) * bnl::ulint_size));
+        else
+            r.unshare();
+
+        // The carry holds the high product of the previous blocks, lower than
+        // 2^63 plus the partial sums
+        bnl::ulint carry = 0;
+        for (std::size_t j = 0; j < size; j++) {
+            const bnl::ulint block = n.data[j];
+            const bnl::ulint product = block * low + (carry & bnl::integer::base_mask);
+            r.data[j] = product & bnl::integer::base_mask;
+            carry = (carry >> 32) + (product >> 32) + block * high;
+        }
+
+        r.data[size] = carry & bnl::integer::base_mask;
+        r.data[size + 1] = carry >> 32;
+
+        // Shrink the answer, fixing the sign of zero
+        r.size = size + 2;
+        r.sign = sign;
+        r.shrink();
+    }
+}
+
+// Remainder of each number divided by a modulus, with the sign of the number
+// like the modulo operator
+void bnl::batch_mod(const bnl::integer *const a, const bnl::integer &m, bnl::integer *const ans, const std::size_t &count) {
+    // Division by zero
+    if (bnl::iszero(m))
+        throw std::invalid_argument("can't divide: division by zero");
+
+    // The context is built once for the whole batch
+    bnl::batch_mod(a, bnl::barrett(m), ans, count);
+}
+
+// Remainder of each number divided by the modulus of a Barrett context
+void bnl::batch_mod(const bnl::integer *const a, const bnl::barrett &m, bnl::integer *const ans, const std::size_t &count) {
+    // Slices run by the workers if the batch is large enough, sharing the
+    // context read only
+    const std::vector<std::size_t> parts = slices(a, count);
+    if (!parts.empty()) {
+        std::vector<mod_t> args(parts.size() - 1);
+        std::vector<bnl::task_t> tasks(parts.size() - 1);
+        for (std::size_t i = 0; i < args.size(); i++) {
+            const mod_t slice = {a + parts[i], &m, ans + parts[i], parts[i + 1] - parts[i]};
+            const bnl::task_t task = {mod_t::run, &args[i]};
+            args[i] = slice;
+            tasks[i] = task;
+        }
+
+        bnl::parallel(&tasks[0], tasks.size());
+        return;
+    }
+
+    const bnl::integer &modulus = m.modulus();
+
+    // Larger modulus, the reduced number replaces the numeric data
+    if (modulus.size > 1) {
+        for (std::size_t i = 0; i < count; i++) {
+            bnl::integer rem = m.reduce(a[i]);
+            std::swap(ans[i].data, rem.data);
+            std::swap(ans[i].size, rem.size);
+            ans[i].sign = rem.sign;
+        }
+
+        return;
+    }
+
+    // Single block modulus, by short division from the most significative
+    // block without any temporary number
+    const bnl::ulint word = modulus.data[0];
+    for (std::size_t i = 0; i < count; i++) {
+        bnl::integer &r = ans[i];
+        const bnl::integer &n = a[i];
+
+        bnl::ulint rem = 0;
+        for (std::size_t j = n.size - 1; j < n.size; j--)
+            rem = ((rem << 32) | n.data[j]) % word;
+
+        // Shrink the answer, fixing the sign of zero
+        r.unshare();
+        r.sign = n.sign;
+        r.data[0] = rem;
+        r.size = 1;
+        r.shrink();
+    }
+}
+
+// Compare each number with a constant, -1 if a < b, 0 if a == b, and 1 if a > b
+void bnl::batch_cmp(const bnl::integer *const a, const bnl::integer &b, int *const ans, const std::size_t &count) {
+    // Different signs, or the magnitudes in the order of the sign
+    for (std::size_t i = 0; i < count; i++) {
+        const int order = a[i].sign != b.sign ? 1 : bnl::integer::cmpabs(a[i], b);
+        ans[i] = a[i].sign ? -order : order;
+    }
+}
+
+// Compare the numbers of the same index
+void bnl::batch_cmp(const bnl::integer *const a, const bnl::integer *const b, int *const ans, const std::size_t &count) {
+    // Different signs, or the magnitudes in the order of the sign
+    for (std::size_t i = 0; i < count; i++) {
+        const int order = a[i].sign != b[i].sign ? 1 : bnl::integer::cmpabs(a[i], b[i]);
+        ans[i] = a[i].sign ? -order : order;
+    }
+}
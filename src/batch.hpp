@@ -0,0 +1,42 @@
+#ifndef __BNL_BATCH_HPP_
+#define __BNL_BATCH_HPP_
+
+#include "integer.hpp" // bnl::integer
+#include "barrett.hpp" // bnl::barrett
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Batch arithmetic functions. The answers are written over the numeric
+    // data of the given numbers, which is only resized when it doesn't fit,
+    // and may be the same numbers as the operands of the same index. Large
+    // batches are split between the workers, so the answers must be reserved
+    // by a thread safe allocator in that case
+
+    // Sum of each number and a constant, that isn't one of the answers
+    void batch_add(const bnl::integer *const a, const bnl::integer &b, bnl::integer *const ans, const std::size_t &count);
+
+    // Sum of the numbers of the same index
+    void batch_add(const bnl::integer *const a, const bnl::integer *const b, bnl::integer *const ans, const std::size_t &count);
+
+    // Product of each number by a machine word
+    void batch_mul_scalar(const bnl::integer *const a, const bnl::lint &k, bnl::integer *const ans, const std::size_t &count);
+
+    // Remainder of each number divided by a modulus, with the sign of the
+    // number like the modulo operator
+    void batch_mod(const bnl::integer *const a, const bnl::integer &m, bnl::integer *const ans, const std::size_t &count);
+
+    // Remainder of each number divided by the modulus of a Barrett context
+    void batch_mod(const bnl::integer *const a, const bnl::barrett &m, bnl::integer *const ans, const std::size_t &count);
+
+    // Compare each number with a constant, -1 if a < b, 0 if a == b, and 1 if
+    // a > b
+    void batch_cmp(const bnl::integer *const a, const bnl::integer &b, int *const ans, const std::size_t &count);
+
+    // Compare the numbers of the same index
+    void batch_cmp(const bnl::integer *const a, const bnl::integer *const b, int *const ans, const std::size_t &count);
+}
+
+#endif // __BNL_BATCH_HPP_
@@ -17,10 +17,23 @@ namespace bnl {
     // Unsigned long int assumed to be 8 bytes wide
     typedef unsigned long int ulint;
 
+    // Long int assumed to be 8 bytes wide
+    typedef long int lint;
+
     // Long double assumed to be 16 bytes wide
     typedef long double ldouble;
 
 
+    // Enumerations
+
+    // Order of the bytes inside a word, or of the words inside a number
+    enum endian {
+        big_endian,
+        little_endian,
+        native_endian
+    };
+
+
     // Type sizes
 
     // Unsigned long int size
@@ -32,6 +45,9 @@ namespace bnl {
     // Unsigned long int size
     const std::size_t ulint_size = sizeof(bnl::ulint);
 
+    // Long int size
+    const std::size_t lint_size = sizeof(bnl::lint);
+
     // Unsigned long int size
     const std::size_t ldouble_size = sizeof(bnl::ldouble);
 }
@@ -0,0 +1,192 @@
+#include "crt.hpp"
+#include "mpn.hpp" // bnl::mpn
+
+#include <stdexcept> // std::invalid_argument
+
+
+// Machine word functions
+
+// Modular inverse of a word, or zero if it does not exist
+static bnl::ulint inverse(const bnl::ulint &a, const bnl::ulint &m) {
+    // Extended Euclid's algorithm with the cofactors of a
+    bnl::lint s0 = 1, s1 = 0;
+    bnl::ulint x = a % m, y = m;
+
+    while (y) {
+        const bnl::ulint q = x / y;
+        bnl::ulint tmp = x - q * y;
+        x = y;
+        y = tmp;
+
+        const bnl::lint s = s0 - static_cast<bnl::lint>(q) * s1;
+        s0 = s1;
+        s1 = s;
+    }
+
+    // Not coprime
+    if (x != 1)
+        return 0;
+
+    // Least positive representative
+    return s0 < 0 ? static_cast<bnl::ulint>(s0 + static_cast<bnl::lint>(m)) : static_cast<bnl::ulint>(s0);
+}
+
+
+// Private static methods
+
+// Build the product tree of the moduli
+const std::vector<std::vector<bnl::integer> > bnl::crt::build(const std::vector<bnl::ulint> &moduli) {
+    // Check the moduli
+    if (moduli.empty())
+        throw std::invalid_argument("can't build bnl::crt: there are no moduli");
+
+    for (std::size_t i = 0; i < moduli.size(); i++)
+        if ((moduli[i] < 2) || (moduli[i] >= bnl::integer::base))
+            throw std::invalid_argument("can't build bnl::crt: modulus out of range");
+
+
+    // Leaves
+    std::vector<std::vector<bnl::integer> > tree(1);
+    tree[0].reserve(moduli.size());
+    for (std::size_t i = 0; i < moduli.size(); i++)
+        tree[0].push_back(bnl::integer::word(moduli[i]));
+
+    // Multiply the pairs of nodes until the root
+    while (tree.back().size() > 1) {
+        const std::vector<bnl::integer> &children = tree.back();
+        std::vector<bnl::integer> level;
+        level.reserve((children.size() + 1) >> 1);
+
+        for (std::size_t i = 0; i < children.size(); i += 2)
+            level.push_back(i + 1 < children.size() ? children[i] * children[i + 1] : children[i]);
+
+        tree.push_back(level);
+    }
+
+    return tree;
+}
+
+// Remainder of the magnitude of a number divided by a modulus
+bnl::ulint bnl::crt::mod(const bnl::integer &n, const bnl::ulint &m) {
+    return bnl::mpn::mod_1(n.data, n.size, m);
+}
+
+
+// Private methods
+
+// Remainders of a magnitude lower than the given node product
+void bnl::crt::residues(const bnl::integer &n, const std::size_t &level, const std::size_t &node, std::vector<bnl::ulint> &ans) const {
+    // Leaf
+    if (!level) {
+        ans[node] = bnl::crt::mod(n, moduli[node]);
+        return;
+    }
+
+    // Single child carried from the previous level
+    const std::size_t left = node << 1;
+    const std::size_t right = left + 1;
+    const std::vector<bnl::integer> &children = tree[level - 1];
+
+    if (right >= children.size()) {
+        residues(n, level - 1, left, ans);
+        return;
+    }
+
+    // Reduce the number by each child product
+    residues(bnl::integer::cmpabs(n, children[left]) < 0 ? n : n % children[left], level - 1, left, ans);
+    residues(bnl::integer::cmpabs(n, children[right]) < 0 ? n : n % children[right], level - 1, right, ans);
+}
+
+
+// Constructors
+
+// Constructor from moduli
+bnl::crt::crt(const std::vector<bnl::ulint> &moduli) : moduli(moduli), tree(bnl::crt::build(moduli)), inverses(moduli.size()), ctx(tree.back()[0]) {
+    // Product of the moduli outside each node, modulo the node product,
+    // from the root to the leaves
+    std::vector<bnl::integer> outer(1, bnl::integer::one);
+
+    for (std::size_t level = tree.size() - 1; level; level--) {
+        const std::vector<bnl::integer> &children = tree[level - 1];
+        std::vector<bnl::integer> next(children.size());
+
+        for (std::size_t i = 0; i < outer.size(); i++) {
+            const std::size_t left = i << 1;
+            const std::size_t right = left + 1;
+
+            // Single child
+            if (right >= children.size()) {
+                next[left] = outer[i];
+                continue;
+            }
+
+            // Each child is multiplied by the sibling product
+            next[left] = outer[i] * children[right] % children[left];
+            next[right] = outer[i] * children[left] % children[right];
+        }
+
+        outer.swap(next);
+    }
+
+    // Invert the leaves, the moduli are pairwise coprime only if all exist
+    for (std::size_t i = 0; i < moduli.size(); i++) {
+        inverses[i] = inverse(bnl::crt::mod(outer[i], moduli[i]), moduli[i]);
+
+        if (!inverses[i])
+            throw std::invalid_argument("can't build bnl::crt: moduli are not pairwise coprime");
+    }
+}
+
+
+// Methods
+
+// The remainders of a number modulo each modulus, in [0, m)
+const std::vector<bnl::ulint> bnl::crt::residues(const bnl::integer &n) const {
+    // Remainder tree over the magnitude
+    std::vector<bnl::ulint> ans(moduli.size());
+    residues(bnl::integer::cmpabs(n, ctx.modulus()) < 0 ? n : n % ctx, tree.size() - 1, 0, ans);
+
+    // Negative numbers
+    if (n.sign)
+        for (std::size_t i = 0; i < ans.size(); i++)
+            if (ans[i])
+                ans[i] = moduli[i] - ans[i];
+
+    return ans;
+}
+
+// The number in [0, M), or in (-M/2, M/2] if balanced, with the given remainders
+const bnl::integer bnl::crt::reconstruct(const std::vector<bnl::ulint> &residues, const bool &balanced) const {
+    // Check the residues
+    if (residues.size() != moduli.size())
+        throw std::invalid_argument("can't reconstruct with bnl::crt: invalid number of residues");
+
+
+    // Leaves scaled by their inverses
+    std::vector<bnl::integer> values;
+    values.reserve(moduli.size());
+    for (std::size_t i = 0; i < moduli.size(); i++)
+        values.push_back(bnl::integer::word((residues[i] % moduli[i]) * inverses[i] % moduli[i]));
+
+    // Combine each pair of nodes with the sibling products until the root
+    for (std::size_t level = 1; level < tree.size(); level++) {
+        const std::vector<bnl::integer> &children = tree[level - 1];
+        std::vector<bnl::integer> next;
+        next.reserve(tree[level].size());
+
+        for (std::size_t i = 0; i < values.size(); i += 2)
+            next.push_back(i + 1 < values.size() ? values[i] * children[i + 1] + values[i + 1] * children[i] : values[i]);
+
+        values.swap(next);
+    }
+
+
+    // Reduce the sum to the least positive representative
+    bnl::integer ans = values[0] % ctx;
+
+    // Symmetric representative
+    if (balanced && (bnl::integer::cmpabs(ans + ans, ctx.modulus()) > 0))
+        ans -= ctx.modulus();
+
+    return ans;
+}
@@ -0,0 +1,68 @@
+#ifndef __BNL_CRT_HPP_
+#define __BNL_CRT_HPP_
+
+#include "integer.hpp" // bnl::integer
+#include "barrett.hpp" // bnl::barrett
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Chinese Remainder Theorem engine over small pairwise coprime moduli
+    class crt {
+        private:
+            // Attributes
+
+            // Moduli, each one lower than the representation base
+            std::vector<bnl::ulint> moduli;
+
+            // Product tree of the moduli, from the leaves to the root
+            std::vector<std::vector<bnl::integer> > tree;
+
+            // Inverse of the product of the other moduli, modulo each modulus
+            std::vector<bnl::ulint> inverses;
+
+            // Reduction context of the product of all the moduli
+            bnl::barrett ctx;
+
+
+            // Static methods
+
+            // Build the product tree of the moduli
+            static const std::vector<std::vector<bnl::integer> > build(const std::vector<bnl::ulint> &moduli);
+
+            // Remainder of the magnitude of a number divided by a modulus
+            static bnl::ulint mod(const bnl::integer &n, const bnl::ulint &m);
+
+
+            // Methods
+
+            // Remainders of a magnitude lower than the given node product
+            void residues(const bnl::integer &n, const std::size_t &level, const std::size_t &node, std::vector<bnl::ulint> &ans) const;
+
+
+        public:
+            // Constructors
+
+            // Constructor from moduli
+            crt(const std::vector<bnl::ulint> &moduli);
+
+
+            // Methods
+
+            // The product of all the moduli
+            inline const bnl::integer &modulus() const {
+                return ctx.modulus();
+            }
+
+            // The remainders of a number modulo each modulus, in [0, m)
+            const std::vector<bnl::ulint> residues(const bnl::integer &n) const;
+
+            // The number in [0, M), or in (-M/2, M/2] if balanced, with the given remainders
+            const bnl::integer reconstruct(const std::vector<bnl::ulint> &residues, const bool &balanced = false) const;
+    };
+}
+
+#endif // __BNL_CRT_HPP_
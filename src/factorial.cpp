@@ -0,0 +1,192 @@
+#include "factorial.hpp"
+
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+
+// Sizes
+
+// Largest n with n! lower than 2^64
+static const bnl::ulint small_factorial = 20;
+
+// Largest n with every binomial coefficient C(n, k) lower than 2^64
+static const bnl::ulint small_binomial = 67;
+
+
+// Lookup tables
+
+// Factorials and binomial coefficients lower than 2^64
+static const struct tables_t {
+    // Attributes
+
+    // Factorials of n <= small_factorial
+    bnl::ulint factorial[small_factorial + 1];
+
+    // Pascal's triangle of n <= small_binomial
+    std::vector<std::vector<bnl::ulint> > pascal;
+
+
+    // Constructors
+
+    // Fill the tables
+    tables_t() : pascal(small_binomial + 1) {
+        factorial[0] = 1;
+        for (bnl::ulint i = 1; i <= small_factorial; i++)
+            factorial[i] = factorial[i - 1] * i;
+
+        for (bnl::ulint n = 0; n <= small_binomial; n++) {
+            pascal[n].assign(n + 1, 1);
+            for (bnl::ulint k = 1; k < n; k++)
+                pascal[n][k] = pascal[n - 1][k - 1] + pascal[n - 1][k];
+        }
+    }
+} tables;
+
+
+// Product trees
+
+// Factors packed in data blocks, with the factors of two counted apart
+struct leaves_t {
+    // Attributes
+
+    // Products of consecutive odd factors, each one lower than the base if
+    // possible
+    std::vector<bnl::ulint> words;
+
+    // Exponent of the factors of two
+    bnl::ulint twos;
+
+
+    // Constructors
+
+    // Empty product
+    leaves_t() : words(1, 1), twos(0) {}
+
+
+    // Methods
+
+    // Multiply by a non-zero factor
+    void push(bnl::ulint factor) {
+        // Factors of two
+        while (!(factor & 1)) {
+            factor >>= 1;
+            twos++;
+        }
+
+        // Pack the factor into the last word while it fits in a data block,
+        // a word of a large factor is never packed, so the product can't wrap
+        if ((words.back() < bnl::integer::base) && (factor < bnl::integer::base) && (words.back() * factor < bnl::integer::base))
+            words.back() *= factor;
+        else
+            words.push_back(factor);
+    }
+};
+
+// Product of the nodes multiplying the pairs of nodes until the root, so the
+// factors of each multiplication have similar sizes
+static const bnl::integer product(std::vector<bnl::integer> &nodes) {
+    while (nodes.size() > 1) {
+        std::vector<bnl::integer> level;
+        level.reserve((nodes.size() + 1) >> 1);
+
+        for (std::size_t i = 0; i < nodes.size(); i += 2)
+            level.push_back(i + 1 < nodes.size() ? nodes[i] * nodes[i + 1] : nodes[i]);
+
+        nodes.swap(level);
+    }
+
+    return nodes[0];
+}
+
+// Product of the packed odd factors of the leaves, without the factors of two
+static const bnl::integer product(const leaves_t &leaves) {
+    std::vector<bnl::integer> nodes;
+    nodes.reserve(leaves.words.size());
+    for (std::size_t i = 0; i < leaves.words.size(); i++) {
+        // Each word split in two data blocks
+        const bnl::ulint blocks[2] = {leaves.words[i] & bnl::integer::base_mask, leaves.words[i] >> 32};
+        nodes.push_back(bnl::integer(bnl::integer_view(blocks, blocks[1] ? 2 : 1)));
+    }
+
+    return product(nodes);
+}
+
+
+// Methods
+
+// Returns the factorial of n
+const bnl::integer bnl::factorial(const bnl::ulint &n) {
+    // Lookup table
+    if (n <= small_factorial)
+        return bnl::integer::word(tables.factorial[n]);
+
+    return bnl::multifactorial(n, 1);
+}
+
+// Returns the multifactorial n (n - k) (n - 2k) ... of step k
+const bnl::integer bnl::multifactorial(const bnl::ulint &n, const bnl::ulint &k) {
+    // Check the step
+    if (!k)
+        throw std::invalid_argument("can't compute multifactorial: zero step");
+
+    // Factors greater than one
+    leaves_t leaves;
+    for (bnl::ulint i = n; i > 1; i = i > k ? i - k : 0)
+        leaves.push(i);
+
+    // Product tree of the odd parts and the factors of two
+    return product(leaves) << bnl::integer::word(leaves.twos);
+}
+
+// Returns the binomial coefficient C(n, k)
+const bnl::integer bnl::binomial(const bnl::ulint &n, const bnl::ulint &k) {
+    // Out of range
+    if (k > n)
+        return bnl::integer::zero;
+
+    // Lookup table
+    if (n <= small_binomial)
+        return bnl::integer::word(tables.pascal[n][k]);
+
+    // Symmetry
+    const bnl::ulint r = k < n - k ? k : n - k;
+    if (!r)
+        return bnl::integer::one;
+
+
+    // Factors of the numerator n (n - 1) ... (n - r + 1) and the denominator r!
+    leaves_t num, den;
+    for (bnl::ulint i = 0; i < r; i++) {
+        num.push(n - i);
+        den.push(i + 1);
+    }
+
+    // Product trees of the odd parts, the quotient is exact, as the binomial
+    // coefficient has exactly the remaining factors of two
+    return product(num) / product(den) << bnl::integer::word(num.twos - den.twos);
+}
+
+// Returns the product of the primes lower than or equal to n
+const bnl::integer bnl::primorial(const bnl::ulint &n) {
+    // Sieve of Eratosthenes over the odd numbers, index i is 2i + 1
+    const bnl::ulint count = (n + 1) >> 1;
+    std::vector<bool> composite(count, false);
+    leaves_t leaves;
+
+    if (n >= 2)
+        leaves.push(2);
+
+    for (bnl::ulint i = 1; i < count; i++) {
+        if (composite[i])
+            continue;
+
+        const bnl::ulint p = (i << 1) + 1;
+        leaves.push(p);
+
+        for (bnl::ulint j = (p * p) >> 1; j < count; j += p)
+            composite[j] = true;
+    }
+
+    // Product tree of the odd primes and the factor of two
+    return product(leaves) << bnl::integer::word(leaves.twos);
+}
@@ -0,0 +1,16 @@
+#ifndef __BNL_FACTORIAL_HPP_
+#define __BNL_FACTORIAL_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::ulint
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Combinatorial functions
+    const bnl::integer factorial(const bnl::ulint &n);
+    const bnl::integer multifactorial(const bnl::ulint &n, const bnl::ulint &k);
+    const bnl::integer binomial(const bnl::ulint &n, const bnl::ulint &k);
+    const bnl::integer primorial(const bnl::ulint &n);
+}
+
+#endif // __BNL_FACTORIAL_HPP_
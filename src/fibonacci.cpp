@@ -0,0 +1,72 @@
+#include "fibonacci.hpp"
+
+
+// Sizes
+
+// Largest n with F(n) lower than 2^64
+static const bnl::ulint small_fib = 93;
+
+
+// Methods
+
+// Returns the Fibonacci number F(n)
+const bnl::integer bnl::fib(const bnl::ulint &n) {
+    return bnl::fib2(n).fib;
+}
+
+// Returns the Fibonacci numbers F(n) and F(n - 1)
+const bnl::fib2_t bnl::fib2(const bnl::ulint &n) {
+    // F(0) = 0 and F(-1) = 1
+    if (!n)
+        return bnl::fib2_t(bnl::integer::zero, bnl::integer::one);
+
+    // Leading bits of n lower than or equal to small_fib
+    std::size_t shift = 0;
+    while ((n >> shift) > small_fib)
+        shift++;
+
+    // F(k) and F(k - 1) with machine words
+    bnl::ulint k = n >> shift;
+    bnl::ulint curr = 1, prev = 0;
+    for (bnl::ulint i = 1; i < k; i++) {
+        const bnl::ulint next = curr + prev;
+        prev = curr;
+        curr = next;
+    }
+
+    bnl::integer f = bnl::integer::word(curr);
+    bnl::integer f1 = bnl::integer::word(prev);
+
+
+    // Doubling formulas for each remaining bit of n, two squares per bit
+    const bnl::integer two = bnl::integer::word(2);
+
+    for (std::size_t i = shift - 1; i < shift; i--) {
+        // F(k)^2 and F(k - 1)^2
+        const bnl::integer a = f * f;
+        const bnl::integer b = f1 * f1;
+
+        // F(2k + 1) = 4 F(k)^2 - F(k - 1)^2 + 2 (-1)^k, F(2k - 1) = F(k)^2 + F(k - 1)^2
+        f = k & 1 ? (a << two) - b - two : (a << two) - b + two;
+        f1 = a + b;
+
+        // F(2k) = F(2k + 1) - F(2k - 1)
+        if ((n >> i) & 1) {
+            f1 = f - f1;
+            k = (k << 1) + 1;
+        }
+        else {
+            f -= f1;
+            k <<= 1;
+        }
+    }
+
+    return bnl::fib2_t(f, f1);
+}
+
+// Returns the Lucas number L(n)
+const bnl::integer bnl::lucas(const bnl::ulint &n) {
+    // L(n) = F(n) + 2 F(n - 1)
+    const bnl::fib2_t f = bnl::fib2(n);
+    return f.fib + (f.prev << bnl::integer::one);
+}
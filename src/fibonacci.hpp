@@ -0,0 +1,33 @@
+#ifndef __BNL_FIBONACCI_HPP_
+#define __BNL_FIBONACCI_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::ulint
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Fibonacci and Lucas numbers functions
+    const bnl::integer fib(const bnl::ulint &n);
+    const bnl::fib2_t fib2(const bnl::ulint &n);
+    const bnl::integer lucas(const bnl::ulint &n);
+
+
+    // Structure returned by bnl::fib2
+    struct fib2_t {
+        // Attributes
+
+        // Fibonacci number F(n)
+        bnl::integer fib;
+
+        // Previous Fibonacci number F(n - 1)
+        bnl::integer prev;
+
+
+        // Constructors
+
+        // Initializator
+        fib2_t(const bnl::integer &f = bnl::integer::zero, const bnl::integer &p = bnl::integer::zero) : fib(f), prev(p) {}
+    };
+}
+
+#endif // __BNL_FIBONACCI_HPP_
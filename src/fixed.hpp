@@ -0,0 +1,606 @@
+#ifndef __BNL_FIXED_HPP_
+#define __BNL_FIXED_HPP_
+
+#include "integer.hpp" // bnl::integer
+
+#include <cstddef>   // std::size_t
+#include <stdexcept> // std::invalid_argument
+#include <string>    // std::string
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Fixed width integer class template. The data blocks are stored inline, so
+    // the arithmetic never reserves memory, and it wraps modulo 2^Bits like the
+    // built-in unsigned types. Signed numbers are stored in two's complement
+    template <std::size_t Bits, bool Signed = false>
+    class fixed {
+        private:
+            // Width check, there is at least one bit
+            typedef char width_check[Bits ? 1 : -1];
+
+
+            // Static constants
+
+            // Number of data blocks of 32 bits
+            static const std::size_t blocks = (Bits + 31) >> 5;
+
+            // Bit mask of the used bits of the most significative data block
+            static const bnl::uint top_mask = Bits & 31 ? (1u << (Bits & 31)) - 1 : 0xFFFFFFFFu;
+
+
+            // Attributes
+
+            // Numeric data array from the least significative block
+            bnl::uint data[blocks];
+
+
+            // Static methods
+
+            // Two's complement of the data blocks modulo 2^Bits
+            static void negate(bnl::uint *const n) {
+                bnl::ulint carry = 1;
+                for (std::size_t i = 0; i < blocks; i++) {
+                    const bnl::ulint sum = static_cast<bnl::ulint>(~n[i] & 0xFFFFFFFFu) + carry;
+                    n[i] = static_cast<bnl::uint>(sum);
+                    carry = sum >> 32;
+                }
+
+                n[blocks - 1] &= top_mask;
+            }
+
+            // Compare the data blocks as unsigned and returns -1 if a < b, 0
+            // if a == b, and 1 if a > b
+            static int cmp(const bnl::uint *const a, const bnl::uint *const b) {
+                for (std::size_t i = blocks - 1; i < blocks; i--)
+                    if (a[i] != b[i])
+                        return a[i] < b[i] ? -1 : 1;
+
+                return 0;
+            }
+
+            // Long division of the unsigned data blocks with b > 0 (Knuth's
+            // algorithm D)
+            static void divrem(const bnl::uint *const a, const bnl::uint *const b, bnl::uint *const quot, bnl::uint *const rem) {
+                for (std::size_t i = 0; i < blocks; i++)
+                    quot[i] = rem[i] = 0;
+
+                // Dividend lower than the divisor
+                if (cmp(a, b) < 0) {
+                    for (std::size_t i = 0; i < blocks; i++)
+                        rem[i] = a[i];
+
+                    return;
+                }
+
+                // Significative sizes
+                std::size_t m = blocks;
+                std::size_t n = blocks;
+                while ((m > 1) && !a[m - 1])
+                    m--;
+
+                while ((n > 1) && !b[n - 1])
+                    n--;
+
+                // Short division
+                if (n == 1) {
+                    bnl::ulint r = 0;
+                    for (std::size_t i = m - 1; i < m; i--) {
+                        r = (r << 32) | a[i];
+                        quot[i] = static_cast<bnl::uint>(r / b[0]);
+                        r %= b[0];
+                    }
+
+                    rem[0] = static_cast<bnl::uint>(r);
+                    return;
+                }
+
+                // Normalization, the most significative bit of the divisor set
+                std::size_t s = 0;
+                while (!((b[n - 1] << s) & 0x80000000u))
+                    s++;
+
+                bnl::uint u[blocks + 1];
+                bnl::uint v[blocks];
+
+                u[m] = s ? a[m - 1] >> (32 - s) : 0;
+                for (std::size_t i = m - 1; i > 0; i--)
+                    u[i] = (a[i] << s) | (s ? a[i - 1] >> (32 - s) : 0);
+                u[0] = a[0] << s;
+
+                for (std::size_t i = n - 1; i > 0; i--)
+                    v[i] = (b[i] << s) | (s ? b[i - 1] >> (32 - s) : 0);
+                v[0] = b[0] << s;
+
+                // Each quotient block from the most significative
+                for (std::size_t j = m - n + 1; j-- > 0;) {
+                    // Estimation from the two leading blocks, at most one unit
+                    // larger after the correction
+                    const bnl::ulint num = (static_cast<bnl::ulint>(u[j + n]) << 32) | u[j + n - 1];
+                    bnl::ulint qhat = num / v[n - 1];
+                    bnl::ulint rhat = num % v[n - 1];
+
+                    while ((qhat >> 32) || (qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]))) {
+                        qhat--;
+                        rhat += v[n - 1];
+                        if (rhat >> 32)
+                            break;
+                    }
+
+                    // Multiply and subtract
+                    bnl::ulint borrow = 0;
+                    bnl::lint t = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                        const bnl::ulint p = qhat * v[i];
+                        t = static_cast<bnl::lint>(u[i + j]) - static_cast<bnl::lint>(borrow) - static_cast<bnl::lint>(p & 0xFFFFFFFFu);
+                        u[i + j] = static_cast<bnl::uint>(t);
+                        borrow = (p >> 32) - (t >> 32);
+                    }
+
+                    t = static_cast<bnl::lint>(u[j + n]) - static_cast<bnl::lint>(borrow);
+                    u[j + n] = static_cast<bnl::uint>(t);
+
+                    // Add back if the estimation was one unit larger
+                    quot[j] = static_cast<bnl::uint>(qhat);
+                    if (t < 0) {
+                        quot[j]--;
+
+                        bnl::ulint carry = 0;
+                        for (std::size_t i = 0; i < n; i++) {
+                            const bnl::ulint sum = static_cast<bnl::ulint>(u[i + j]) + v[i] + carry;
+                            u[i + j] = static_cast<bnl::uint>(sum);
+                            carry = sum >> 32;
+                        }
+
+                        u[j + n] += static_cast<bnl::uint>(carry);
+                    }
+                }
+
+                // Unnormalize the remainder
+                for (std::size_t i = 0; i < n; i++)
+                    rem[i] = (u[i] >> s) | (s ? u[i + 1] << (32 - s) : 0);
+            }
+
+
+            // Methods
+
+            // Whether the number is negative
+            inline bool negative() const {
+                return Signed && ((data[blocks - 1] >> ((Bits - 1) & 31)) & 1);
+            }
+
+            // Whether the number is zero
+            inline bool zero() const {
+                for (std::size_t i = 0; i < blocks; i++)
+                    if (data[i])
+                        return false;
+
+                return true;
+            }
+
+            // Signed quotient or remainder, truncated toward zero
+            void div(const bnl::fixed<Bits, Signed> &n, const bool &quotient) {
+                // Division by zero
+                if (n.zero())
+                    throw std::invalid_argument("can't divide: division by zero");
+
+                // Magnitudes, the most negative value is its own magnitude
+                const bool a_sign = negative();
+                const bool b_sign = n.negative();
+
+                bnl::uint a[blocks];
+                bnl::uint b[blocks];
+                for (std::size_t i = 0; i < blocks; i++) {
+                    a[i] = data[i];
+                    b[i] = n.data[i];
+                }
+
+                if (a_sign)
+                    negate(a);
+
+                if (b_sign)
+                    negate(b);
+
+                // Quotient sign by both signs, remainder sign by the dividend
+                bnl::uint quot[blocks];
+                bnl::uint rem[blocks];
+                divrem(a, b, quot, rem);
+
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] = quotient ? quot[i] : rem[i];
+
+                if (quotient ? a_sign != b_sign : a_sign)
+                    negate(data);
+            }
+
+
+        public:
+            // Friend classes
+
+            // Fixed integers of other widths
+            template <std::size_t B, bool S>
+            friend class bnl::fixed;
+
+
+            // Constructors
+
+            // Constructor from a machine word, sign extended
+            fixed(const bnl::lint &n = 0) {
+                const bnl::ulint word = static_cast<bnl::ulint>(n);
+                const bnl::uint fill = n < 0 ? 0xFFFFFFFFu : 0;
+
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] = i < 2 ? static_cast<bnl::uint>(i ? word >> 32 : word) : fill;
+
+                data[blocks - 1] &= top_mask;
+            }
+
+            // Constructor from an integer, keeping its lowest Bits bits
+            explicit fixed(const bnl::integer &n) {
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] = i < n.size ? static_cast<bnl::uint>(n.data[i]) : 0;
+
+                data[blocks - 1] &= top_mask;
+                if (n.sign)
+                    negate(data);
+            }
+
+            // Constructor from a fixed integer of other width, sign extended
+            // if it is signed
+            template <std::size_t B, bool S>
+            explicit fixed(const bnl::fixed<B, S> &n) {
+                const bnl::uint fill = n.negative() ? 0xFFFFFFFFu : 0;
+
+                for (std::size_t i = 0; i < blocks; i++) {
+                    if (i + 1 < n.blocks)
+                        data[i] = n.data[i];
+                    else if (i + 1 == n.blocks)
+                        data[i] = n.data[i] | (fill & ~n.top_mask);
+                    else
+                        data[i] = fill;
+                }
+
+                data[blocks - 1] &= top_mask;
+            }
+
+            // Constructor from std::string
+            fixed(const std::string &str) {
+                *this = bnl::fixed<Bits, Signed>(bnl::integer(str));
+            }
+
+            // Constructor from const char *
+            fixed(const char *const str) {
+                *this = bnl::fixed<Bits, Signed>(bnl::integer(str));
+            }
+
+
+            // Operators overloading
+
+            // Type conversion operators
+
+            // To bnl::integer
+            operator bnl::integer() const {
+                bnl::uint magnitude[blocks];
+                for (std::size_t i = 0; i < blocks; i++)
+                    magnitude[i] = data[i];
+
+                // The most negative value is its own two's complement, with
+                // the magnitude 2^(Bits - 1)
+                const bool sign = negative();
+                if (sign)
+                    negate(magnitude);
+
+                bnl::integer ans(blocks, sign);
+                for (std::size_t i = 0; i < blocks; i++)
+                    ans.data[i] = magnitude[i];
+
+                ans.shrink();
+                return ans;
+            }
+
+
+            // Increment and decrement operators
+
+            // Prefix increment
+            inline bnl::fixed<Bits, Signed> &operator ++ () {
+                return *this += bnl::fixed<Bits, Signed>(1);
+            }
+
+            // Prefix decrement
+            inline bnl::fixed<Bits, Signed> &operator -- () {
+                return *this -= bnl::fixed<Bits, Signed>(1);
+            }
+
+            // Postfix increment
+            inline const bnl::fixed<Bits, Signed> operator ++ (int) {
+                const bnl::fixed<Bits, Signed> ans(*this);
+                ++*this;
+                return ans;
+            }
+
+            // Postfix decrement
+            inline const bnl::fixed<Bits, Signed> operator -- (int) {
+                const bnl::fixed<Bits, Signed> ans(*this);
+                --*this;
+                return ans;
+            }
+
+
+            // Unary operators
+
+            // Integer promotion
+            inline const bnl::fixed<Bits, Signed> &operator + () const {
+                return *this;
+            }
+
+            // Additive inverse, modulo 2^Bits
+            inline const bnl::fixed<Bits, Signed> operator - () const {
+                bnl::fixed<Bits, Signed> ans(*this);
+                negate(ans.data);
+                return ans;
+            }
+
+            // Logical NOT
+            inline bool operator ! () const {
+                return zero();
+            }
+
+            // Bitwise NOT (one's complement)
+            inline const bnl::fixed<Bits, Signed> operator ~ () const {
+                bnl::fixed<Bits, Signed> ans;
+                for (std::size_t i = 0; i < blocks; i++)
+                    ans.data[i] = ~data[i];
+
+                ans.data[blocks - 1] &= top_mask;
+                return ans;
+            }
+
+
+            // Assignment operators
+
+            // Assignation by addition
+            bnl::fixed<Bits, Signed> &operator += (const bnl::fixed<Bits, Signed> &n) {
+                bnl::ulint carry = 0;
+                for (std::size_t i = 0; i < blocks; i++) {
+                    const bnl::ulint sum = static_cast<bnl::ulint>(data[i]) + n.data[i] + carry;
+                    data[i] = static_cast<bnl::uint>(sum);
+                    carry = sum >> 32;
+                }
+
+                data[blocks - 1] &= top_mask;
+                return *this;
+            }
+
+            // Assignation by subtraction
+            bnl::fixed<Bits, Signed> &operator -= (const bnl::fixed<Bits, Signed> &n) {
+                bnl::ulint borrow = 0;
+                for (std::size_t i = 0; i < blocks; i++) {
+                    const bnl::ulint diff = static_cast<bnl::ulint>(data[i]) - n.data[i] - borrow;
+                    data[i] = static_cast<bnl::uint>(diff);
+                    borrow = diff >> 63;
+                }
+
+                data[blocks - 1] &= top_mask;
+                return *this;
+            }
+
+            // Assignation by multiplication, only the lowest Bits bits of the
+            // partial products
+            bnl::fixed<Bits, Signed> &operator *= (const bnl::fixed<Bits, Signed> &n) {
+                bnl::uint ans[blocks];
+                for (std::size_t i = 0; i < blocks; i++)
+                    ans[i] = 0;
+
+                for (std::size_t i = 0; i < blocks; i++) {
+                    bnl::ulint carry = 0;
+                    for (std::size_t j = 0; i + j < blocks; j++) {
+                        const bnl::ulint product = static_cast<bnl::ulint>(data[i]) * n.data[j] + ans[i + j] + carry;
+                        ans[i + j] = static_cast<bnl::uint>(product);
+                        carry = product >> 32;
+                    }
+                }
+
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] = ans[i];
+
+                data[blocks - 1] &= top_mask;
+                return *this;
+            }
+
+            // Assignation by division
+            inline bnl::fixed<Bits, Signed> &operator /= (const bnl::fixed<Bits, Signed> &n) {
+                div(n, true);
+                return *this;
+            }
+
+            // Assignation by modulo
+            inline bnl::fixed<Bits, Signed> &operator %= (const bnl::fixed<Bits, Signed> &n) {
+                div(n, false);
+                return *this;
+            }
+
+            // Assignation by left shift
+            bnl::fixed<Bits, Signed> &operator <<= (const std::size_t &n) {
+                const std::size_t shift = n >> 5;
+                const std::size_t bits = n & 31;
+
+                for (std::size_t i = blocks - 1; i < blocks; i--) {
+                    const bnl::uint high = i >= shift ? data[i - shift] : 0;
+                    const bnl::uint low = i > shift ? data[i - shift - 1] : 0;
+                    data[i] = bits ? (high << bits) | (low >> (32 - bits)) : high;
+                }
+
+                data[blocks - 1] &= top_mask;
+                return *this;
+            }
+
+            // Assignation by right shift, arithmetic if the number is signed
+            bnl::fixed<Bits, Signed> &operator >>= (const std::size_t &n) {
+                const std::size_t shift = n >> 5;
+                const std::size_t bits = n & 31;
+                const bnl::uint fill = negative() ? 0xFFFFFFFFu : 0;
+
+                // Sign extension of the most significative block
+                data[blocks - 1] |= fill & ~top_mask;
+
+                for (std::size_t i = 0; i < blocks; i++) {
+                    const bnl::uint low = i + shift < blocks ? data[i + shift] : fill;
+                    const bnl::uint high = i + shift + 1 < blocks ? data[i + shift + 1] : fill;
+                    data[i] = bits ? (low >> bits) | (high << (32 - bits)) : low;
+                }
+
+                data[blocks - 1] &= top_mask;
+                return *this;
+            }
+
+            // Assignation by bitwise AND
+            inline bnl::fixed<Bits, Signed> &operator &= (const bnl::fixed<Bits, Signed> &n) {
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] &= n.data[i];
+
+                return *this;
+            }
+
+            // Assignation by bitwise OR
+            inline bnl::fixed<Bits, Signed> &operator |= (const bnl::fixed<Bits, Signed> &n) {
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] |= n.data[i];
+
+                return *this;
+            }
+
+            // Assignation by bitwise XOR
+            inline bnl::fixed<Bits, Signed> &operator ^= (const bnl::fixed<Bits, Signed> &n) {
+                for (std::size_t i = 0; i < blocks; i++)
+                    data[i] ^= n.data[i];
+
+                return *this;
+            }
+
+
+            // Arithmetic operators
+
+            // Multiplication
+            friend inline const bnl::fixed<Bits, Signed> operator * (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans *= b;
+            }
+
+            // Division
+            friend inline const bnl::fixed<Bits, Signed> operator / (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans /= b;
+            }
+
+            // Modulo
+            friend inline const bnl::fixed<Bits, Signed> operator % (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans %= b;
+            }
+
+            // Addition
+            friend inline const bnl::fixed<Bits, Signed> operator + (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans += b;
+            }
+
+            // Subtraction
+            friend inline const bnl::fixed<Bits, Signed> operator - (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans -= b;
+            }
+
+            // Left shift
+            friend inline const bnl::fixed<Bits, Signed> operator << (const bnl::fixed<Bits, Signed> &a, const std::size_t &n) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans <<= n;
+            }
+
+            // Right shift
+            friend inline const bnl::fixed<Bits, Signed> operator >> (const bnl::fixed<Bits, Signed> &a, const std::size_t &n) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans >>= n;
+            }
+
+
+            // Comparison and relational operators
+
+            // Greater than
+            friend inline bool operator > (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return b < a;
+            }
+
+            // Less than, the negative numbers first
+            friend inline bool operator < (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                const bool a_sign = a.negative();
+                if (a_sign != b.negative())
+                    return a_sign;
+
+                return bnl::fixed<Bits, Signed>::cmp(a.data, b.data) < 0;
+            }
+
+            // Greater than or equal to
+            friend inline bool operator >= (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return !(a < b);
+            }
+
+            // Less than or equal to
+            friend inline bool operator <= (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return !(b < a);
+            }
+
+            // Equal to
+            friend inline bool operator == (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return !bnl::fixed<Bits, Signed>::cmp(a.data, b.data);
+            }
+
+            // Not equal to
+            friend inline bool operator != (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return bnl::fixed<Bits, Signed>::cmp(a.data, b.data) != 0;
+            }
+
+
+            // Bitwise operators
+
+            // Bitwise AND
+            friend inline const bnl::fixed<Bits, Signed> operator & (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans &= b;
+            }
+
+            // Bitwise OR (inclusive or)
+            friend inline const bnl::fixed<Bits, Signed> operator | (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans |= b;
+            }
+
+            // Bitwise XOR (exclusive or)
+            friend inline const bnl::fixed<Bits, Signed> operator ^ (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                bnl::fixed<Bits, Signed> ans(a);
+                return ans ^= b;
+            }
+
+
+            // Logic operators
+
+            // Logical AND
+            friend inline bool operator && (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return !a.zero() && !b.zero();
+            }
+
+            // Logical OR
+            friend inline bool operator || (const bnl::fixed<Bits, Signed> &a, const bnl::fixed<Bits, Signed> &b) {
+                return !a.zero() || !b.zero();
+            }
+    };
+
+
+    // Static constants definitions
+    template <std::size_t Bits, bool Signed>
+    const std::size_t bnl::fixed<Bits, Signed>::blocks;
+
+    template <std::size_t Bits, bool Signed>
+    const bnl::uint bnl::fixed<Bits, Signed>::top_mask;
+}
+
+#endif // __BNL_FIXED_HPP_
@@ -0,0 +1,267 @@
+#include "gcd.hpp"
+#include "mpn.hpp"    // bnl::mpn
+#include "tuning.hpp" // bnl::thresholds
+#include "stats.hpp"  // BNL_STAT
+
+#include <algorithm> // std::swap, std::min, std::max
+#include <stdexcept> // std::invalid_argument
+
+
+// Numeric data functions
+
+// Compare and returns -1 if a < b, 0 if a == b, and 1 if a > b
+static int cmp(const bnl::ulint *const a, const std::size_t &a_size, const bnl::ulint *const b, const std::size_t &b_size) {
+    // Check sizes
+    if (a_size != b_size)
+        return a_size < b_size ? -1 : 1;
+
+    return bnl::mpn::cmp(a, b, a_size);
+}
+
+// Subtract b from a in place with a > b, returns the new size of a
+static std::size_t sub(bnl::ulint *const a, const std::size_t &a_size, const bnl::ulint *const b, const std::size_t &b_size) {
+    bnl::mpn::sub(a, a, a_size, b, b_size);
+    return bnl::mpn::normalize(a, a_size);
+}
+
+// Right shift of non-zero numeric data in place, returns the new size
+static std::size_t shr(bnl::ulint *const data, const std::size_t &size, const std::size_t &bits) {
+    // Block shift moving the blocks down, and bit shift
+    const std::size_t ans = size - (bits >> 5);
+    bnl::mpn::rshift(data, data + (bits >> 5), ans, bits & 31);
+
+    return bnl::mpn::normalize(data, ans);
+}
+
+// The 60 bits of numeric data starting from the given bit
+static bnl::lint top(const bnl::ulint *const data, const std::size_t &size, const std::size_t &bit) {
+    // Gather the three blocks containing the bits
+    const std::size_t block = bit >> 5;
+    const std::size_t offset = bit & 31;
+
+    if (block >= size)
+        return 0;
+
+    const bnl::ulint low = data[block] | (block + 1 < size ? data[block + 1] << 32 : 0);
+    const bnl::ulint high = block + 2 < size ? data[block + 2] : 0;
+
+    return static_cast<bnl::lint>((low >> offset) | (offset ? high << (64 - offset) : 0));
+}
+
+
+// Private static methods
+
+// Lehmer's steps over x >= y >= 0 while y is larger than the given size
+void bnl::integer::lehmer(bnl::integer &x, bnl::integer &y, const std::size_t &size, bnl::integer *const s0, bnl::integer *const s1) {
+    while (y.size > size) {
+        // Leading bits of both numbers at the same position
+        const std::size_t bits = x.precision();
+        const std::size_t shift = bits > 60 ? bits - 60 : 0;
+        bnl::lint x_top = top(x.data, x.size, shift);
+        bnl::lint y_top = top(y.data, y.size, shift);
+
+        // Euclid's steps over the leading bits while the quotients are exact
+        bnl::lint a = 1, b = 0, c = 0, d = 1;
+        while ((y_top + c > 0) && (y_top + d > 0)) {
+            const bnl::lint q = (x_top + a) / (y_top + c);
+            if (q != (x_top + b) / (y_top + d))
+                break;
+
+            bnl::lint tmp = a - q * c;
+            a = c;
+            c = tmp;
+
+            tmp = b - q * d;
+            b = d;
+            d = tmp;
+
+            tmp = x_top - q * y_top;
+            x_top = y_top;
+            y_top = tmp;
+        }
+
+        // Full division step if the leading bits were not enough
+        if (!b) {
+            const bnl::div_t qr = bnl::integer::div(x, y);
+            x = y;
+            y = qr.rem;
+
+            // Update the cofactors
+            if (s0) {
+                const bnl::integer tmp = *s0 - qr.quot * *s1;
+                *s0 = *s1;
+                *s1 = tmp;
+            }
+
+            continue;
+        }
+
+        // Apply the cofactors matrix
+        const bnl::integer ma = bnl::integer::word(a < 0 ? -a : a, a < 0);
+        const bnl::integer mb = bnl::integer::word(b < 0 ? -b : b, b < 0);
+        const bnl::integer mc = bnl::integer::word(c < 0 ? -c : c, c < 0);
+        const bnl::integer md = bnl::integer::word(d < 0 ? -d : d, d < 0);
+
+        const bnl::integer tmp = ma * x + mb * y;
+        y = mc * x + md * y;
+        x = tmp;
+
+        // Update the cofactors
+        if (s0) {
+            const bnl::integer tmp = ma * *s0 + mb * *s1;
+            *s1 = mc * *s0 + md * *s1;
+            *s0 = tmp;
+        }
+    }
+}
+
+
+// Methods
+
+// Returns the greatest common divisor of two numbers
+const bnl::integer bnl::gcd(const bnl::integer &a, const bnl::integer &b) {
+    BNL_STAT(bnl::STAT_GCD, std::max(a.size, b.size));
+
+    // Zeros
+    if (bnl::iszero(a))
+        return bnl::abs(b);
+
+    if (bnl::iszero(b))
+        return bnl::abs(a);
+
+
+    // Magnitudes sorted in descending order
+    bnl::integer x = bnl::abs(a);
+    bnl::integer y = bnl::abs(b);
+
+    if (bnl::integer::cmpabs(x, y) < 0) {
+        std::swap(x.data, y.data);
+        std::swap(x.size, y.size);
+    }
+
+    // Lehmer's steps for the large numbers
+    bnl::integer::lehmer(x, y, bnl::thresholds().lehmer);
+
+    if (bnl::iszero(y))
+        return x;
+
+    // Reduce the largest number to the size of the smallest
+    if (x.size > y.size) {
+        x = bnl::integer::div(x, y).rem;
+
+        if (bnl::iszero(x))
+            return y;
+    }
+
+
+    // Binary GCD with the common powers of two removed, in place over numbers
+    // that may share their numeric data
+    x.unshare();
+    y.unshare();
+
+    const std::size_t x_zeros = bnl::mpn::ctz(x.data, x.size);
+    const std::size_t y_zeros = bnl::mpn::ctz(y.data, y.size);
+    const std::size_t zeros = std::min(x_zeros, y_zeros);
+
+    x.size = shr(x.data, x.size, x_zeros);
+    y.size = shr(y.data, y.size, y_zeros);
+
+    // Binary GCD main bucle over odd numbers
+    for (int order = cmp(x.data, x.size, y.data, y.size); order; order = cmp(x.data, x.size, y.data, y.size)) {
+        // Keep the largest number in x
+        if (order < 0) {
+            std::swap(x.data, y.data);
+            std::swap(x.size, y.size);
+        }
+
+        // The difference is even
+        x.size = sub(x.data, x.size, y.data, y.size);
+        x.size = shr(x.data, x.size, bnl::mpn::ctz(x.data, x.size));
+    }
+
+
+    // Restore the common powers of two
+    x.shrink();
+    return x << bnl::integer::word(zeros);
+}
+
+// Returns the least common multiple of two numbers
+const bnl::integer bnl::lcm(const bnl::integer &a, const bnl::integer &b) {
+    // Zeros
+    if (bnl::iszero(a) || bnl::iszero(b))
+        return bnl::integer::zero;
+
+    // Divide before multiply to keep the operands small
+    return bnl::abs(a / bnl::gcd(a, b) * b);
+}
+
+// Returns the greatest common divisor and the Bezout coefficients
+const bnl::gcdext_t bnl::gcdext(const bnl::integer &a, const bnl::integer &b) {
+    BNL_STAT(bnl::STAT_GCD, std::max(a.size, b.size));
+
+    // Zeros
+    if (bnl::iszero(b))
+        return bnl::gcdext_t(bnl::abs(a), bnl::iszero(a) ? bnl::integer::zero : (a.sign ? -bnl::integer::one : bnl::integer::one));
+
+    if (bnl::iszero(a))
+        return bnl::gcdext_t(bnl::abs(b), bnl::integer::zero, b.sign ? -bnl::integer::one : bnl::integer::one);
+
+
+    // Magnitudes sorted in descending order
+    const bool swapped = bnl::integer::cmpabs(a, b) < 0;
+    const bnl::integer m = bnl::abs(swapped ? b : a);
+    const bnl::integer n = bnl::abs(swapped ? a : b);
+
+    // Remainders and cofactors of m
+    bnl::integer x = m;
+    bnl::integer y = n;
+    bnl::integer s0 = bnl::integer::one;
+    bnl::integer s1 = bnl::integer::zero;
+
+    // Lehmer's steps for the large numbers
+    bnl::integer::lehmer(x, y, bnl::thresholds().lehmer, &s0, &s1);
+
+    // Euclid's steps for the small numbers
+    while (!bnl::iszero(y)) {
+        const bnl::div_t qr = bnl::integer::div(x, y);
+        x = y;
+        y = qr.rem;
+
+        const bnl::integer tmp = s0 - qr.quot * s1;
+        s0 = s1;
+        s1 = tmp;
+    }
+
+    // Cofactor of n from the Bezout identity
+    const bnl::integer t0 = (x - s0 * m) / n;
+
+
+    // Answer with the cofactors in the arguments order and sign
+    bnl::gcdext_t ans(x, swapped ? t0 : s0, swapped ? s0 : t0);
+    if (a.sign)
+        ans.s = -ans.s;
+
+    if (b.sign)
+        ans.t = -ans.t;
+
+    return ans;
+}
+
+// Returns the modular inverse of a number
+const bnl::integer bnl::invert(const bnl::integer &a, const bnl::integer &m) {
+    // Check the modulus
+    if (bnl::iszero(m))
+        throw std::invalid_argument("can't invert: modulus is zero");
+
+    // The inverse exists only for coprime numbers
+    const bnl::gcdext_t e = bnl::gcdext(a, m);
+    if (!bnl::isone(e.gcd))
+        throw std::invalid_argument("can't invert: number and modulus are not coprime");
+
+    // Least positive representative
+    bnl::integer ans = e.s % m;
+    if (bnl::isneg(ans))
+        ans += bnl::abs(m);
+
+    return ans;
+}
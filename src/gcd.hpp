@@ -0,0 +1,37 @@
+#ifndef __BNL_GCD_HPP_
+#define __BNL_GCD_HPP_
+
+#include "integer.hpp" // bnl::integer
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Greatest common divisor functions
+    const bnl::integer gcd(const bnl::integer &a, const bnl::integer &b);
+    const bnl::integer lcm(const bnl::integer &a, const bnl::integer &b);
+    const bnl::gcdext_t gcdext(const bnl::integer &a, const bnl::integer &b);
+    const bnl::integer invert(const bnl::integer &a, const bnl::integer &m);
+
+
+    // Structure returned by bnl::gcdext
+    struct gcdext_t {
+        // Attributes
+
+        // Greatest common divisor, always positive
+        bnl::integer gcd;
+
+        // Bezout coefficient of the first number
+        bnl::integer s;
+
+        // Bezout coefficient of the second number
+        bnl::integer t;
+
+
+        // Constructors
+
+        // Initializator
+        gcdext_t(const bnl::integer &g = bnl::integer::zero, const bnl::integer &s = bnl::integer::zero, const bnl::integer &t = bnl::integer::zero) : gcd(g), s(s), t(t) {}
+    };
+}
+
+#endif // __BNL_GCD_HPP_
@@ -0,0 +1,60 @@
+#include "hash.hpp"
+
+
+// Constants
+
+// Odd multipliers of the golden ratio and of the SplitMix64 finalizer
+static const bnl::ulint hash_k0 = 0x9e3779b97f4a7c15UL;
+static const bnl::ulint hash_k1 = 0xbf58476d1ce4e5b9UL;
+static const bnl::ulint hash_k2 = 0x94d049bb133111ebUL;
+
+
+// Machine word functions
+
+// Left rotation of a word
+static inline bnl::ulint rotl(const bnl::ulint &x, const int &bits) {
+    return (x << bits) | (x >> (64 - bits));
+}
+
+// Hash state updated with a word
+static inline bnl::ulint update(const bnl::ulint &h, const bnl::ulint &word) {
+    return rotl(h ^ (word * hash_k0), 31) * hash_k1;
+}
+
+// Final avalanche of the SplitMix64 generator
+static inline bnl::ulint mix(bnl::ulint x) {
+    x = (x ^ (x >> 30)) * hash_k1;
+    x = (x ^ (x >> 27)) * hash_k2;
+    return x ^ (x >> 31);
+}
+
+
+// Hash functions
+
+// Returns the hash of a value with the given seed
+std::size_t bnl::hash(const bnl::integer_view &n, const std::size_t &seed) {
+    // Two independent states over words of two data blocks, so both products
+    // run at the same time
+    const bnl::ulint *const data = n.data;
+    bnl::ulint h0 = seed ^ hash_k0;
+    bnl::ulint h1 = rotl(seed, 32) ^ hash_k2;
+
+    std::size_t i = 0;
+    for (; i + 4 <= n.size; i += 4) {
+        h0 = update(h0, data[i] | (data[i + 1] << 32));
+        h1 = update(h1, data[i + 2] | (data[i + 3] << 32));
+    }
+
+    // Remaining data blocks
+    for (; i < n.size; i++)
+        h0 = update(h0, data[i]);
+
+    // The size and the sign, so the values with the same blocks are different
+    return static_cast<std::size_t>(mix(h0 ^ rotl(h1, 32) ^ ((static_cast<bnl::ulint>(n.size) << 1) | (n.sign ? 1 : 0))));
+}
+
+
+// Constructors
+
+// Number with its hash
+bnl::hashed::hashed(const bnl::integer &n) : n(n), h(bnl::hash(n)) {}
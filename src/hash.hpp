@@ -0,0 +1,138 @@
+#ifndef __BNL_HASH_HPP_
+#define __BNL_HASH_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::integer_view
+
+#include <cstddef> // std::size_t
+
+#if __cplusplus >= 201103L
+#include <functional> // std::hash, std::equal_to
+#endif
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Hash functions
+
+    // Returns the hash of a value with the given seed, computed over its data
+    // blocks two at a time. Equal numbers and views have the same hash
+    std::size_t hash(const bnl::integer_view &n, const std::size_t &seed = 0);
+
+
+    // Number with its hash computed once, for the keys of the hash containers.
+    // The number can't change, so the hash is never computed again
+    class hashed {
+        private:
+            // Attributes
+
+            // Number, sharing the numeric data of the original one
+            bnl::integer n;
+
+            // Hash of the number
+            std::size_t h;
+
+
+        public:
+            // Constructors
+
+            // Number with its hash
+            hashed(const bnl::integer &n);
+
+
+            // Methods
+
+            // The number
+            inline const bnl::integer &value() const {
+                return n;
+            }
+
+            // The hash of the number
+            inline std::size_t hash() const {
+                return h;
+            }
+    };
+
+
+    // Hash function object of the hash containers, like the ones of TR1
+    struct hasher {
+        // Hash of a number
+        inline std::size_t operator () (const bnl::integer &n) const {
+            return bnl::hash(n);
+        }
+
+        // Hash of a view
+        inline std::size_t operator () (const bnl::integer_view &n) const {
+            return bnl::hash(n);
+        }
+
+        // Hash of a number with its hash, already computed
+        inline std::size_t operator () (const bnl::hashed &n) const {
+            return n.hash();
+        }
+    };
+
+    // Equality function object of the hash containers, the operators are
+    // global so the standard std::equal_to doesn't find them
+    struct equal {
+        // Equality of numbers
+        inline bool operator () (const bnl::integer &a, const bnl::integer &b) const {
+            return a == b;
+        }
+
+        // Equality of views
+        inline bool operator () (const bnl::integer_view &a, const bnl::integer_view &b) const {
+            return a == b;
+        }
+
+        // Equality of numbers with their hashes, the hashes compared first
+        inline bool operator () (const bnl::hashed &a, const bnl::hashed &b) const {
+            return (a.hash() == b.hash()) && (a.value() == b.value());
+        }
+    };
+}
+
+
+// Comparison and relational operators
+inline bool operator == (const bnl::hashed &a, const bnl::hashed &b) {
+    return bnl::equal()(a, b);
+}
+
+inline bool operator != (const bnl::hashed &a, const bnl::hashed &b) {
+    return !(a == b);
+}
+
+
+// Hash and equality specializations of the standard hash containers
+#if __cplusplus >= 201103L
+namespace std {
+    template <>
+    struct hash<bnl::integer> {
+        inline std::size_t operator () (const bnl::integer &n) const {
+            return bnl::hash(n);
+        }
+    };
+
+    template <>
+    struct hash<bnl::hashed> {
+        inline std::size_t operator () (const bnl::hashed &n) const {
+            return n.hash();
+        }
+    };
+
+    template <>
+    struct equal_to<bnl::integer> {
+        inline bool operator () (const bnl::integer &a, const bnl::integer &b) const {
+            return bnl::equal()(a, b);
+        }
+    };
+
+    template <>
+    struct equal_to<bnl::hashed> {
+        inline bool operator () (const bnl::hashed &a, const bnl::hashed &b) const {
+            return bnl::equal()(a, b);
+        }
+    };
+}
+#endif
+
+#endif // __BNL_HASH_HPP_
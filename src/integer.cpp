@@ -1,7 +1,13 @@
 #include "integer.hpp"
+#include "mpn.hpp"    // bnl::mpn
+#include "radix.hpp"  // bnl::radix
+#include "tuning.hpp" // bnl::thresholds
+#include "stats.hpp"  // BNL_STAT, bnl::stat_shrink
 
 #include <stdexcept> // std::invalid_argument
 #include <iomanip>   // std::setfill, std::setw, std::setprecision
+#include <algorithm> // std::swap, std::reverse, std::max
+#include <new>       // std::bad_alloc
 
 
 // Static constants
@@ -19,28 +25,223 @@ const bnl::integer bnl::integer::zero;
 const bnl::integer bnl::integer::one("1");
 
 
+// Sizes
+
+// Decimal digits of each chunk read from or written to the streams
+static const std::size_t decimal_digits = 9;
+
+// Chunk base 10^decimal_digits, the largest power of ten lower than the base
+static const bnl::ulint decimal_base = 1000000000;
+
+// Characters buffered before each write to the stream buffer
+static const std::size_t stream_buffer = 4096;
+
+
+// Numeric data functions
+
+// Multiply the numeric data by m and add a, both lower than the base. The data
+// grows doubling its capacity when the last carry doesn't fit
+static void muladd(bnl::ulint *&data, std::size_t &size, std::size_t &capacity, const bnl::ulint &m, const bnl::ulint &a) {
+    // The carries of both kernels add up to a block lower than the base
+    bnl::ulint carry = bnl::mpn::mul_1(data, data, size, m);
+    carry += bnl::mpn::add_1(data, data, size, a);
+
+    if (!carry)
+        return;
+
+    if (size == capacity) {
+        bnl::ulint *const grown = static_cast<bnl::ulint *>(bnl::realloc(data, (capacity << 1) * bnl::ulint_size));
+        if (!grown)
+            throw std::bad_alloc();
+
+        data = grown;
+        capacity <<= 1;
+    }
+
+    data[size++] = carry;
+}
+
+// Maximum decimal chunks of n data blocks, each block has less than 9.64
+// decimal digits
+static inline std::size_t decimal_size(const std::size_t &n) {
+    return n + (n >> 3) + 2;
+}
+
+// Decimal chunks of the magnitude of n data blocks from the least
+// significative, each one with decimal_digits digits but the last. The answer
+// has at least decimal_size(n) blocks, returns the number of chunks
+static std::size_t decimal(const bnl::ulint *const data, const std::size_t &n, bnl::ulint *const ans) {
+    // Copy of the magnitude divided in place
+    const bnl::scratch mem(n);
+    bnl::ulint *const num = mem.data();
+    for (std::size_t i = 0; i < n; i++)
+        num[i] = data[i];
+
+    // Short division by the chunk base from the most significative block
+    std::size_t size = n;
+    std::size_t count = 0;
+    do {
+        ans[count++] = bnl::mpn::divrem_1(num, num, size, decimal_base);
+        size = bnl::mpn::normalize(num, size);
+    } while (size);
+
+    return count;
+}
+
+// Write count fill characters to the stream buffer, returns whether all of
+// them were written
+static bool fill(std::streambuf *const output, const char &c, std::size_t count) {
+    char buffer[stream_buffer];
+    const std::size_t size = count < stream_buffer ? count : stream_buffer;
+    for (std::size_t i = 0; i < size; i++)
+        buffer[i] = c;
+
+    while (count) {
+        const std::size_t used = count < stream_buffer ? count : stream_buffer;
+        if (output->sputn(buffer, used) != static_cast<std::streamsize>(used))
+            return false;
+
+        count -= used;
+    }
+
+    return true;
+}
+
+// Write the digits of a chunk, padded with zeros to decimal_digits if pad is
+// set, returns the number of characters written
+static std::size_t digits(char *const buffer, bnl::ulint chunk, const bool &pad) {
+    char tmp[decimal_digits];
+    std::size_t n = 0;
+
+    do {
+        tmp[decimal_digits - ++n] = static_cast<char>('0' + chunk % 10);
+        chunk /= 10;
+    } while (chunk);
+
+    while (pad && (n < decimal_digits))
+        tmp[decimal_digits - ++n] = '0';
+
+    for (std::size_t i = 0; i < n; i++)
+        buffer[i] = tmp[decimal_digits - n + i];
+
+    return n;
+}
+
+
 // Private static methods
 
 // Compare and returns -1 if a < b, 0 if a == b, and 1 if a > b
-int bnl::integer::cmp(const bnl::integer &a, const bnl::integer &b) {
-    // Compare each data block from the most significative to the
-    // least significative
-    for (std::size_t i = a.size - 1; i < a.size; i--)
-        if (a.data[i] != b.data[i])
-            // Returns 1 if a < b, or -1 if a > b
-            return a.data[i] < b.data[i] ? -1 : 1;
-
-    // Return 0 if the numbers are equal
-    return 0;
+int bnl::integer::cmp(const bnl::integer_view &a, const bnl::integer_view &b) {
+    // Compare each data block from the most significative, both numbers have
+    // the same size
+    return bnl::mpn::cmp(a.data, b.data, a.size);
+}
+
+// Compare the magnitudes and returns -1 if |a| < |b|, 0 if |a| == |b|, and 1 if |a| > |b|
+int bnl::integer::cmpabs(const bnl::integer_view &a, const bnl::integer_view &b) {
+    // Check sizes
+    if (a.size != b.size)
+        return a.size < b.size ? -1 : 1;
+
+    // Full comparison
+    return bnl::integer::cmp(a, b);
 }
 
 // Copy n data blocks of numeric data from source to destiny
-inline void bnl::integer::cpy(bnl::ulint *const dest, const bnl::ulint *const src, const std::size_t &n) {
+void bnl::integer::cpy(bnl::ulint *const dest, const bnl::ulint *const src, const std::size_t &n) {
     // Copy each data block
     for (std::size_t i = 0; i < n; i++)
         dest[i] = src[i];
 }
 
+// Long division of the magnitudes with |a| >= |b| > 0 (Knuth's algorithm D)
+void bnl::integer::divrem(const bnl::integer_view &a, const bnl::integer_view &b, bnl::integer &quot, bnl::integer &rem) {
+    BNL_STAT(bnl::STAT_DIV_LONG, a.size);
+
+    // Operands sizes
+    const std::size_t n = b.size;
+    const std::size_t m = a.size - n;
+
+    // Quotient memory
+    quot.size = m + 1;
+    quot.data = static_cast<bnl::ulint *>(bnl::realloc(quot.data, quot.size * bnl::ulint_size));
+
+
+    // Single block divisor
+    if (n == 1) {
+        const bnl::ulint carry = bnl::mpn::divrem_1(quot.data, a.data, a.size, b.data[0]);
+
+        // The remainder is the last carry
+        rem.size = 1;
+        rem.data = static_cast<bnl::ulint *>(bnl::realloc(rem.data, bnl::ulint_size));
+        rem.data[0] = carry;
+        return;
+    }
+
+
+    // Normalization shiftment to set the highest bit of the divisor
+    std::size_t shift_l = 0;
+    for (bnl::ulint top = b.data[n - 1]; !(top & (bnl::integer::base >> 1)); top <<= 1)
+        shift_l++;
+
+    // Normalized dividend and divisor
+    const bnl::scratch u_mem(a.size + 1);
+    const bnl::scratch v_mem(n);
+    bnl::ulint *const u = u_mem.data();
+    bnl::ulint *const v = v_mem.data();
+
+    u[a.size] = bnl::mpn::lshift(u, a.data, a.size, shift_l);
+    bnl::mpn::lshift(v, b.data, n, shift_l);
+
+
+    // Division main loop
+    for (std::size_t j = m; j <= m; j--) {
+        // Estimate the quotient block from the top blocks
+        const bnl::ulint num = (u[j + n] << 32) | u[j + n - 1];
+        bnl::ulint qhat = num / v[n - 1];
+        bnl::ulint rhat = num % v[n - 1];
+
+        // Correct the estimation, at most two times
+        while ((qhat >= bnl::integer::base) || (qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]))) {
+            qhat--;
+            rhat += v[n - 1];
+            if (rhat >= bnl::integer::base)
+                break;
+        }
+
+        // Multiply and subtract
+        const bnl::ulint diff = u[j + n] - bnl::mpn::submul_1(u + j, v, n, qhat);
+        u[j + n] = diff & bnl::integer::base_mask;
+
+        // Add back if the estimation was one unit too large
+        if (diff >> 63) {
+            qhat--;
+            u[j + n] = (u[j + n] + bnl::mpn::add_n(u + j, u + j, v, n)) & bnl::integer::base_mask;
+        }
+
+        // Quotient block
+        quot.data[j] = qhat;
+    }
+
+
+    // Unnormalize the remainder
+    rem.size = n;
+    rem.data = static_cast<bnl::ulint *>(bnl::realloc(rem.data, n * bnl::ulint_size));
+    bnl::mpn::rshift(rem.data, u, n, shift_l);
+}
+
+// Square of the magnitude
+const bnl::integer bnl::integer::sqr(const bnl::integer_view &n) {
+    BNL_STAT(bnl::STAT_SQR, n.size);
+
+    bnl::integer ans(n.size << 1, false);
+    bnl::mpn::sqr(ans.data, n.data, n.size);
+
+    // Shrink and return the answer
+    ans.shrink();
+    return ans;
+}
+
 // Returns whether the given character if the point character
 inline bool bnl::integer::isexp(const char &c) {
     return (c == 'e') || (c == 'E');
@@ -61,17 +262,63 @@ inline bool bnl::integer::issign(const char &c) {
     return (c == '-') || (c == '+');
 }
 
+// Integer from the magnitude of a machine word and a sign
+const bnl::integer bnl::integer::word(const bnl::ulint &n, const bool &sign) {
+    // Split the word in two data blocks
+    bnl::integer ans(2, sign);
+    ans.data[0] = n & bnl::integer::base_mask;
+    ans.data[1] = n >> 32;
+
+    // Shrink and return the answer
+    ans.shrink();
+    return ans;
+}
+
+// Decimal chunks of 9 digits of the magnitude from the least significative,
+// returns the number of chunks. The large numbers are split by divide and
+// conquer
+std::size_t bnl::integer::todecimal(const bnl::integer_view &n, bnl::ulint *const chunks) {
+    if (n.size < bnl::thresholds().split)
+        return decimal(n.data, n.size, chunks);
+
+    BNL_STAT(bnl::STAT_RADIX_SPLIT, n.size);
+    return bnl::radix(n.size).chunks(n, chunks);
+}
+
+// Magnitude from its decimal chunks of 9 digits from the least significative.
+// The large numbers are joined by divide and conquer
+const bnl::integer bnl::integer::fromdecimal(const bnl::ulint *const chunks, const std::size_t &count) {
+    // Each chunk has less than 29.9 bits
+    if (count >= bnl::thresholds().join) {
+        BNL_STAT(bnl::STAT_RADIX_JOIN, ((count * 15) >> 4) + 1);
+        return bnl::radix(((count * 15) >> 4) + 1, false).value(chunks, count);
+    }
+
+    // Multiply and accumulate from the most significative chunk, the chunks
+    // never need more data blocks
+    bnl::integer ans(count, false);
+    std::size_t size = 1;
+    std::size_t capacity = count;
+    for (std::size_t i = count - 1; i < count; i--)
+        muladd(ans.data, size, capacity, decimal_base, chunks[i]);
+
+    ans.shrink();
+    return ans;
+}
+
 
 // Private constructors
 
 // Empty integer
-inline bnl::integer::integer(const std::size_t &size, const bool &sign) : data(NULL), size(size), sign(sign) {
+bnl::integer::integer(const std::size_t &size, const bool &sign) : data(NULL), size(size), sign(sign) {
     // Check size
     if (!size)
         throw std::invalid_argument("can't build bnl::integer from private constructor: invalid size");
 
     // Reserve empty memory
-    data = static_cast<bnl::ulint *>(std::calloc(size, bnl::ulint_size));
+    data = static_cast<bnl::ulint *>(bnl::calloc(size, bnl::ulint_size));
+    if (!data)
+        throw std::bad_alloc();
 }
 
 
@@ -111,12 +358,29 @@ std::size_t bnl::integer::precision(bool *twos_pow) const {
 
 // Shrink numeric data
 void bnl::integer::shrink() {
+#ifdef BNL_STATS
+    const std::size_t old_size = size;
+#endif
+
     // Update size
     for (std::size_t i = size - 1; i && !data[i]; i--)
         size--;
 
+    // Zero is always positive
+    if ((size == 1) && !data[0])
+        sign = false;
+
     // Resize the numeric data
-    data = static_cast<bnl::ulint *>(std::realloc(data, size * bnl::ulint_size));
+#ifdef BNL_STATS
+    bnl::stat_shrink(old_size * bnl::ulint_size, size * bnl::ulint_size);
+#endif
+
+    data = static_cast<bnl::ulint *>(bnl::realloc(data, size * bnl::ulint_size));
+}
+
+// Copy the numeric data if it is shared
+void bnl::integer::unshare() {
+    data = static_cast<bnl::ulint *>(bnl::unshare(data));
 }
 
 
@@ -255,149 +519,46 @@ std::size_t bnl::integer::precision(const bnl::integer &n) {
 
 // Integer division
 const bnl::div_t bnl::integer::div(const bnl::integer &a, const bnl::integer &b) {
-    // Zeros
-    if (bnl::iszero(a))
-        return bnl::div_t(bnl::integer::zero, bnl::integer::zero);
+    return bnl::integer::div(bnl::integer_view(a), bnl::integer_view(b));
+}
 
-    if (bnl::iszero(a))
+// Integer division of views
+const bnl::div_t bnl::integer::div(const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_DIV, std::max(a.size, b.size));
+
+    // Division by zero
+    if (bnl::iszero(b))
         throw std::invalid_argument("can't divide: division by zero");
 
+    // Zero dividend
+    if (bnl::iszero(a))
+        return bnl::div_t(bnl::integer::zero, bnl::integer::zero);
+
     // Ones
     if (bnl::isone(b))
-        return bnl::div_t(b.sign ? -a : a, bnl::integer::zero);
-
-    // Same number
-    if (a == b)
-        return bnl::div_t(bnl::integer::one, bnl::integer::zero);
+        return bnl::div_t(bnl::integer(b.sign ? -a : a), bnl::integer::zero);
 
     // Divisor larger than dividend
-    if (b > a)
-        return bnl::div_t(bnl::integer::zero, a);
-
-
-    // Operands precision
-    bool twos_pow;
-    const std::size_t bits_a = a.precision();
-    const std::size_t bits_b = b.precision(&twos_pow);
+    const int order = bnl::integer::cmpabs(a, b);
+    if (order < 0)
+        return bnl::div_t(bnl::integer::zero, bnl::integer(a));
 
-    // Bitwise operations if the divisor is power of two
-    if (twos_pow) {
-        // Operators and answer variables
-        const std::size_t shiftment = bits_b - 1;
-        const std::size_t mod_mask = (bits_b << 1) - 1;
-        bnl::div_t ans;
-
-        // Positive dividend
-        if (!a.sign) {
-            ans.quot = a >> static_cast<bnl::ldouble>(shiftment);
-            ans.rem = a & static_cast<bnl::ldouble>(mod_mask);
-        }
-
-        // Negative dividend
-        else {
-            const bnl::integer a_pos = -a;
-            ans.quot = a_pos >> static_cast<bnl::ldouble>(shiftment);
-            ans.rem = a_pos & static_cast<bnl::ldouble>(mod_mask);
-        }
+    // Same magnitude
+    if (!order)
+        return bnl::div_t(a.sign == b.sign ? bnl::integer::one : -bnl::integer::one, bnl::integer::zero);
 
-        // Quotient sign
-        ans.quot.sign = a.sign ^ b.sign;
 
-        // Return the answer
-        return ans;
-    }
+    // Long division of the magnitudes
+    bnl::div_t ans;
+    bnl::integer::divrem(a, b, ans.quot, ans.rem);
 
-    // Operands and answer variables
-    const std::size_t bits_diff = bits_a - bits_b;
-    div_t ans;
-    ans.rem = a >> static_cast<bnl::ldouble>(bits_diff);
+    // Quotient truncated toward zero and remainder with the dividend sign
     ans.quot.sign = a.sign ^ b.sign;
+    ans.rem.sign = a.sign;
 
-    // Bit selector and shiftments offset
-    bnl::ulint bit_shiftment = (bits_diff & 31) - 1;
-    bnl::ulint bit_selector = static_cast<bnl::ulint>(1) << bit_shiftment;
-    bnl::ulint offset;
-
-
-    // Division main loop
-    for (std::size_t i = 0, j = bits_diff >> 5; i < bits_diff; i++, bit_selector >>= 1) {
-        // Quotient shiftment
-        offset = 0;
-        for (std::size_t k = 0; k < ans.quot.size; k++) {
-            const bnl::ulint tmp = ans.quot.data[k];
-            ans.quot.data[k] = (offset >> 31) | (ans.quot.data[k] << 1);
-            offset = tmp;
-        }
-
-        // Left overflow
-        offset >>= 31;
-        if (offset) {
-            // Resize and append offset
-            ans.quot.size++;
-            ans.quot.data = static_cast<bnl::ulint *>(std::realloc(ans.quot.data, ans.quot.size * bnl::ulint_size));
-            ans.quot.data[ans.quot.size - 1] = offset;
-        }
-
-        // Subtraction
-        if (ans.rem >= b) {
-            ans.rem = ans.rem - b;
-            ans.quot.data[0] |= 1;
-        }
-
-        //Remainder shiftment
-        offset = 0;
-        for (std::size_t k = 0; k < ans.quot.size; k++) {
-            ans.rem.data[k] = (offset >> 31) | ((ans.rem.data[k] << 1) & bnl::integer::base_mask);
-            offset = ans.rem.data[k];
-        }
-
-        // Left overflow
-        offset >>= 31;
-        if (offset) {
-            // Resize and append offset
-            ans.rem.size++;
-            ans.rem.data = static_cast<bnl::ulint *>(std::realloc(ans.rem.data, ans.rem.size * bnl::ulint_size));
-            ans.rem.data[ans.rem.size - 1] = offset;
-        }
-
-        // Reset the bit selector
-        if (!bit_selector) {
-            bit_selector = bnl::integer::base >> 1;
-            j--;
-        }
-
-        // Append bit from dividend to remanider
-        const bnl::ulint bit = a.data[j] & bit_selector;
-        if (bit)
-            ans.rem.data[0] |= 1;
-    }
-
-    // Last subtraction
-
-    // Quotient shiftment
-    offset = 0;
-    for (std::size_t k = 0; k < ans.quot.size; k++) {
-        ans.quot.data[k] = (offset >> 31) | ((ans.quot.data[k] << 1) & bnl::integer::base_mask);
-        offset = ans.quot.data[k];
-    }
-
-    // Left overflow
-    offset >>= 31;
-    if (offset) {
-        // Resize and append offset
-        ans.quot.size++;
-        ans.quot.data = static_cast<bnl::ulint *>(std::realloc(ans.quot.data, ans.quot.size * bnl::ulint_size));
-        ans.quot.data[ans.quot.size - 1] = offset;
-    }
-
-    // Subtraction
-    if (ans.rem > b) {
-        ans.rem = ans.rem - b;
-        ans.quot.data[0] |= 1;
-    }
-
-
-    // Return the answer
+    // Shrink and return the answer
+    ans.quot.shrink();
+    ans.rem.shrink();
     return ans;
 }
 
@@ -405,15 +566,15 @@ const bnl::div_t bnl::integer::div(const bnl::integer &a, const bnl::integer &b)
 // Public constructors
 
 // Default constructor
-bnl::integer::integer() : data(static_cast<bnl::ulint *>(std::calloc(1, bnl::ulint_size))), size(1), sign(false) {}
+bnl::integer::integer() : data(static_cast<bnl::ulint *>(bnl::calloc(1, bnl::ulint_size))), size(1), sign(false) {}
 
 // Copy constructor
-bnl::integer::integer(const bnl::integer &n) : data(static_cast<bnl::ulint *>(std::malloc(n.size * bnl::ulint_size))), size(n.size), sign(n.sign) {
-    bnl::integer::cpy(data, n.data, size);
-}
+bnl::integer::integer(const bnl::integer &n) : data(static_cast<bnl::ulint *>(bnl::share(n.data))), size(n.size), sign(n.sign) {}
 
 // Constructor from std::string
 bnl::integer::integer(const std::string &str) : data(NULL), size(0), sign(false) {
+    BNL_STAT(bnl::STAT_PARSE, str.size() / 10 + 1);
+
     // Process integer
     const std::string num = bnl::integer::checkstr(str, &sign);
 
@@ -422,63 +583,29 @@ bnl::integer::integer(const std::string &str) : data(NULL), size(0), sign(false)
         throw std::invalid_argument("can't build bnl::integer from std::string: invalid format");
 
 
-    // Reverse Double-Dabble to convert BDC to binary
-
-    // Numeric data size
+    // Decimal chunks from the least significative, the most significative one
+    // may have less digits
     const std::size_t num_size = num.size();
-    size = ((num_size - 1) >> 3) + 1;
-
-    // Algorithm sizes
-    const std::size_t nibbles = size << 3;
-    const std::size_t bits = size << 5;
-
-    // Algorithm memory
-    data = static_cast<bnl::ulint *>(std::calloc(size << 1, bnl::ulint_size));
-    bnl::uchar *const bin = reinterpret_cast<bnl::uchar *>(data);
-    bnl::uchar *const bcd = bin + nibbles;
-
-    const bnl::uchar &bcd_top = bcd[num_size - 1];
-    const std::size_t bin_top = ((size - 1) << 3) + 3;
-
-    // Copy the number data
-    for (std::size_t i = 0; i < num_size; i++)
-        bcd[i] = num[i] - '0';
-
-
-    // Main bucle for each bit
-    for (std::size_t i = 0; i < bits; i++) {
-        bnl::uchar bcd_r = 0;
-        bnl::uchar bcd_l = 0;
-        bnl::uchar bin_r = 0;
-        bnl::uchar bin_l = bcd_top & 1;
-
-        // Shift each block
-        for (std::size_t j = 0, k = bin_top; j < nibbles; j++) {
-            // Shift the binary block
-            if ((j & 7) < 4) {
-                bin_r    = bin[k] & 1;
-                bin[k] >>= 1;
-                bin[k]  |= bin_l << 7;
-                bin_l    = bin_r;
-
-                // Binary block increment
-                k -= k & 7 ? 1 : 5;
-            }
+    const std::size_t count = (num_size - 1) / decimal_digits + 1;
+    const bnl::scratch mem(count);
+    bnl::ulint *const chunks = mem.data();
 
-            // Shift the bcd block
-            bcd_r    = bcd[j] & 1;
-            bcd[j] >>= 1;
-            bcd[j]  |= bcd_l << 3;
-            bcd_l    = bcd_r;
+    for (std::size_t i = 0, end = num_size; i < count; i++, end -= decimal_digits) {
+        const std::size_t begin = end > decimal_digits ? end - decimal_digits : 0;
 
-            // Condition
-            if (bcd[j] >= 8)
-                bcd[j] -= 3;
-        }
+        bnl::ulint chunk = 0;
+        for (std::size_t j = begin; j < end; j++)
+            chunk = chunk * 10 + (num[j] - '0');
+
+        chunks[i] = chunk;
     }
 
+    // Take the numeric data
+    bnl::integer ans = bnl::integer::fromdecimal(chunks, count);
+    std::swap(data, ans.data);
+    std::swap(size, ans.size);
 
-    // Shrink the numeric data
+    // Zero is always positive
     shrink();
 }
 
@@ -506,6 +633,21 @@ bnl::integer::integer(const bnl::ldouble &n) : data(NULL), size(0), sign(false)
     *this = bnl::integer(stream.str());
 }
 
+// Constructor from a view, the numeric data of a whole number is shared and
+// any other data is copied
+bnl::integer::integer(const bnl::integer_view &n) : data(NULL), size(n.size), sign(n.sign) {
+    if (n.whole) {
+        data = static_cast<bnl::ulint *>(bnl::share(const_cast<bnl::ulint *>(n.data)));
+        return;
+    }
+
+    data = static_cast<bnl::ulint *>(bnl::malloc(size * bnl::ulint_size));
+    if (!data)
+        throw std::bad_alloc();
+
+    bnl::integer::cpy(data, n.data, size);
+}
+
 
 // Methods
 
@@ -536,79 +678,32 @@ const bnl::integer bnl::pow(const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Get the string representation with the given radix
-const std::string bnl::str(const bnl::integer &n, const int &radix) {
+const std::string bnl::str(const bnl::integer_view &n, const int &radix) {
+    BNL_STAT(bnl::STAT_STR, n.size);
+
     // Check the radix
     if (radix != 10)
         throw std::invalid_argument("can't convert bnl::integer to std::string: invalid radix");
 
-    // Well known integers
-    static const std::string zero("0");
-    static const std::string one_pos("1");
-    static const std::string one_neg("-1");
-
-    // Zero or one
-    if (bnl::iszero(n)) return zero;
-    if (bnl::isone(n))  return n.sign ? one_neg : one_pos;
-
-
-    // Double-Dabble to convert binary to BCD
-
-    // Algorithm sizes
-    const std::size_t digits = n.size * 10;
-    const std::size_t bits = n.size << 5;
-
-    // Algorithm memory
-    bnl::uchar *const bcd = static_cast<bnl::uchar *>(std::calloc(digits, bnl::uchar_size));
-
-    // Algorithm auxiliar variables
-    const std::size_t digits_top = digits - 1;
-    bool carry = false;
-
-    // Main bucle for each bit
-    for (std::size_t i = bits - 1; i < bits; i--) {
-        bnl::uchar bit_l = 0;
-        bnl::uchar bit_r = (n.data[i >> 5] & (static_cast<bnl::ulint>(1) << (i & 31))) > 0;
+    // Decimal chunks from the least significative
+    const bnl::scratch mem(decimal_size(n.size));
+    bnl::ulint *const chunks = mem.data();
+    const std::size_t count = bnl::integer::todecimal(n, chunks);
 
-        // Shift each block
-        for (std::size_t j = digits_top; j < digits; j--) {
-            // Condition
-            if (bcd[j] >= 5)
-                bcd[j] += 3;
-
-            // Shift BCD
-            bit_l    = bcd[j] >> 3;
-            bcd[j] <<= 1;
-            bcd[j]  &= 15;
-            bcd[j]  |= bit_r;
-            bit_r    = bit_l;
-        }
-
-        // Update carry
-        carry = static_cast<bool>(bit_l);
-    }
-
-
-    // Count zeros
-    std::size_t zeros = 0;
-    for (std::size_t i = 0; i < digits && !bcd[i]; i++)
-        zeros++;
-
-    // Convert digits to character
-    for (std::size_t i = zeros; i < digits; i++)
-        bcd[i] += '0';
-
-    // String sign
+    // Sign and the most significative chunk without leading zeros
+    char buffer[decimal_digits];
     std::string str;
+    str.reserve(count * decimal_digits + 1);
+
     if (n.sign)
-        str.append("-");
+        str.push_back('-');
 
-    // String carry
-    if (carry)
-        str.append("1");
+    str.append(buffer, digits(buffer, chunks[count - 1], false));
+
+    // The other chunks padded with zeros
+    for (std::size_t i = count - 2; i < count; i--)
+        str.append(buffer, digits(buffer, chunks[i], true));
 
-    // Append the BCD data and return it
-    str.append(reinterpret_cast<const char *>(bcd + zeros), digits - zeros);
-    std::free(bcd);
     return str;
 }
 
@@ -658,92 +753,64 @@ const bnl::integer bnl::integer::operator - () const {
 // Arithmetic operators
 
 // Multiplication
-const bnl::integer operator * (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator * (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_MUL, std::max(a.size, b.size));
+
     // Zeros
     if (bnl::iszero(a) || bnl::iszero(b))
         return bnl::integer::zero;
 
     // Ones
     if (bnl::isone(a))
-        return a.sign ? -b : b;
+        return bnl::integer(a.sign ? -b : b);
 
     if (bnl::isone(b))
-        return b.sign ? -a : a;
-
-
-    // Operands and answer variables
-    const bnl::integer &m = a.size > b.size ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
-    bnl::integer ans;
-
-    // Auxiliar variables
-    bnl::integer prod;
-
-
-    // Multiplication main bucle
-    for (std::size_t i = 0; i < n.size; i++) {
-        // Resize the intermediate product
-        prod.size = m.size + i;
-        prod.data = static_cast<bnl::ulint *>(std::realloc(prod.data, prod.size * bnl::ulint_size));
+        return bnl::integer(b.sign ? -a : a);
 
-        // Right padding with zeros
-        for (std::size_t j = 0; j < i; j++)
-            prod.data[j] = 0;
-
-        // Current block and carry
-        const bnl::ulint &block = n.data[i];
-        bnl::ulint carry = 0;
+    // Square of the same numeric data, which may be shared by numbers of
+    // different signs
+    if ((a.data == b.data) && (a.size == b.size)) {
+        bnl::integer ans = bnl::integer::sqr(a);
+        ans.sign = a.sign != b.sign;
+        return ans;
+    }
 
-        // Multiplication
-        for (std::size_t j = i, k = 0; k < m.size; j++, k++) {
-            // Multiply
-            prod.data[j] = m.data[k] * block + carry;
 
-            // Check carry
-            if (prod.data[j] >= bnl::integer::base) {
-                carry = prod.data[j] / bnl::integer::base;
-                prod.data[j] &= bnl::integer::base_mask;
-            }
-
-            // Reset the carry
-            else carry = 0;
-        }
+    // Operands and answer variables
+    const bnl::integer_view &m = a.size > b.size ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
+    bnl::integer ans(m.size + n.size, a.sign ^ b.sign);
 
-        // Carry
-        if (carry) {
-            prod.size++;
-            prod.data = static_cast<bnl::ulint *>(std::realloc(prod.data, prod.size * bnl::ulint_size));
-            prod.data[prod.size - 1] = carry;
-        }
 
-        // Accumulate the intermediate product
-        ans += prod;
-    }
+    // Multiplication of the magnitudes
+    bnl::mpn::mul(ans.data, m.data, m.size, n.data, n.size);
 
 
-    // Set the answer sign and return it
-    ans.sign = a.sign ^ b.sign;
+    // Shrink and return the answer
+    ans.shrink();
     return ans;
 }
 
 // Division
-const bnl::integer operator / (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator / (const bnl::integer_view &a, const bnl::integer_view &b) {
     return bnl::integer::div(a, b).quot;
 }
 
 // Modulo
-const bnl::integer operator % (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator % (const bnl::integer_view &a, const bnl::integer_view &b) {
     return bnl::integer::div(a, b).rem;
 }
 
 // Addition
-const bnl::integer operator + (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator + (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_ADD, std::max(a.size, b.size));
+
     // Zeros
     if (bnl::iszero(a))
-        return b;
+        return bnl::integer(b);
 
     if (bnl::iszero(b))
-        return a;
+        return bnl::integer(a);
 
 
     // Different signs
@@ -755,56 +822,18 @@ const bnl::integer operator + (const bnl::integer &a, const bnl::integer &b) {
 
 
     // Operands and answer variables
-    const bnl::integer &m = a.size >= b.size ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
+    const bnl::integer_view &m = a.size >= b.size ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
     bnl::integer ans(m.size, m.sign);
 
-    // Auxiliar variables
-    std::size_t i = 0;
-    bnl::ulint carry = 0;
-
-
-    // Addition main bucle
-    while (i < n.size) {
-        // Add
-        ans.data[i] = m.data[i] + n.data[i] + carry;
-
-        // Check carry
-        if (ans.data[i] >= bnl::integer::base) {
-            carry = 1;
-            ans.data[i] -= bnl::integer::base;
-        }
-
-        // Reset the carry
-        else carry = 0;
-
-        // Index increment
-        i++;
-    }
-
-    // Extra digits bucle
-    while (i < m.size) {
-        // Add
-        ans.data[i] = m.data[i] + carry;
-
-        // Check carry
-        if (ans.data[i] >= bnl::integer::base) {
-            carry = 1;
-            ans.data[i] -= bnl::integer::base;
-        }
-
-        // Reset the carry
-        else carry = 0;
-
-        // Index increment
-        i++;
-    }
+    // Addition of the magnitudes
+    const bnl::ulint carry = bnl::mpn::add(ans.data, m.data, m.size, n.data, n.size);
 
 
     // Carry
     if (carry) {
         ans.size++;
-        ans.data = static_cast<bnl::ulint *>(std::realloc(ans.data, ans.size * bnl::ulint_size));
+        ans.data = static_cast<bnl::ulint *>(bnl::realloc(ans.data, ans.size * bnl::ulint_size));
         ans.data[ans.size - 1] = 1;
     }
 
@@ -813,9 +842,11 @@ const bnl::integer operator + (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Subtraction
-const bnl::integer operator - (const bnl::integer &a, const bnl::integer &b) {
-    // Same object
-    if (&a == &b)
+const bnl::integer operator - (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_SUB, std::max(a.size, b.size));
+
+    // Same numeric data and sign, the same number or its copies
+    if ((a.data == b.data) && (a.size == b.size) && (a.sign == b.sign))
         return bnl::integer::zero;
 
 
@@ -825,50 +856,12 @@ const bnl::integer operator - (const bnl::integer &a, const bnl::integer &b) {
 
 
     // Operands and answer variables
-    const bnl::integer &m = bnl::abs(a) >= bnl::abs(b) ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
+    const bnl::integer_view &m = bnl::integer::cmpabs(a, b) >= 0 ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
     bnl::integer ans(m.size, &m == &a ? a.sign : !b.sign);
 
-    // Auxiliar variables
-    std::size_t i = 0;
-    bnl::ulint carry = 0;
-
-
-    // Subtraction main bucle
-    while (i < n.size) {
-        // Subtract
-        ans.data[i] = m.data[i] - n.data[i] - carry;
-
-        // Check carry
-        if (ans.data[i] >= bnl::integer::base) {
-            carry = 1;
-            ans.data[i] += bnl::integer::base;
-        }
-
-        // Reset the carry
-        else carry = 0;
-
-        // Index increment
-        i++;
-    }
-
-    // Extra digits bucle
-    while (i < m.size) {
-        // Subtract
-        ans.data[i] = m.data[i] - carry;
-
-        // Check carry
-        if (ans.data[i] >= bnl::integer::base) {
-            carry = 1;
-            ans.data[i] += bnl::integer::base;
-        }
-
-        // Reset the carry
-        else carry = 0;
-
-        // Index increment
-        i++;
-    }
+    // Subtraction of the magnitudes, the larger minus the smaller
+    bnl::mpn::sub(ans.data, m.data, m.size, n.data, n.size);
 
 
     // Shrink the numeric data and return
@@ -877,10 +870,12 @@ const bnl::integer operator - (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Left shift
-const bnl::integer operator << (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator << (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_SHL, a.size);
+
     // Zeros
     if (bnl::iszero(a) || bnl::iszero(b))
-        return a;
+        return bnl::integer(a);
 
     // Negative shift count
     if (b.sign)
@@ -900,21 +895,14 @@ const bnl::integer operator << (const bnl::integer &a, const bnl::integer &b) {
     if (((b.size >= 2) && (b.data[1] >> 5)) || (max_blocks - block_shift < a.size))
         throw memory_limit_exception;
 
-    // Bit shift and answer variables
+    // Bit shift and answer, the lowest blocks are zeros
     const std::size_t shift_l = static_cast<std::size_t>(b.data[0] & 31);
-    const std::size_t shift_r = 32 - shift_l;
-    bnl::ulint offset = 0;
     bnl::integer ans(block_shift + a.size, a.sign);
 
-
-    // Left shift main bucle
-    for (std::size_t i = block_shift, j = 0; j < a.size; i++, j++) {
-        ans.data[i] = (offset >> shift_r) | ((a.data[j] << shift_l) & bnl::integer::base_mask);
-        offset = a.data[j];
-    }
+    // Left shift of the magnitude over the highest blocks
+    const bnl::ulint offset = bnl::mpn::lshift(ans.data + block_shift, a.data, a.size, shift_l);
 
     // Left overflow
-    offset >>= shift_r;
     if (offset) {
         // Check memory limits
         ans.size++;
@@ -922,7 +910,7 @@ const bnl::integer operator << (const bnl::integer &a, const bnl::integer &b) {
             throw memory_limit_exception;
 
         // Resize and append offset
-        ans.data = static_cast<bnl::ulint *>(std::realloc(ans.data, ans.size * bnl::ulint_size));
+        ans.data = static_cast<bnl::ulint *>(bnl::realloc(ans.data, ans.size * bnl::ulint_size));
         ans.data[ans.size - 1] = offset;
     }
 
@@ -932,10 +920,12 @@ const bnl::integer operator << (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Right shift
-const bnl::integer operator >> (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator >> (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_SHR, a.size);
+
     // Zeros
     if (bnl::iszero(a) || bnl::iszero(b))
-        return a;
+        return bnl::integer(a);
 
     // Negative shift count
     if (b.sign)
@@ -945,113 +935,232 @@ const bnl::integer operator >> (const bnl::integer &a, const bnl::integer &b) {
     // Block shift
     const std::size_t block_shift = static_cast<std::size_t>(b.size > 1 ? (b.data[1] << 5) | (b.data[0] >> 5) : b.data[0] >> 5);
 
-    // Check underflow
-    if (block_shift >= a.size)
-        return bnl::integer::zero;
+    // Check underflow, rounding toward negative infinity
+    if ((b.size > 2) || ((b.size == 2) && (b.data[1] >> 27)) || (block_shift >= a.size))
+        return a.sign ? -bnl::integer::one : bnl::integer::zero;
 
-    // Bit shift and answer variables
+    // Bit shift and answer
     const std::size_t shift_r = static_cast<std::size_t>(b.data[0] & 31);
-    const std::size_t shift_l = 32 - shift_r;
-    const bnl::ulint offset_mask = (static_cast<bnl::ulint>(1) << shift_r) - 1;
     bnl::integer ans(a.size - block_shift, a.sign);
 
+    // Right shift of the magnitude, and whether any discarded bit is set
+    bool inexact = bnl::mpn::rshift(ans.data, a.data + block_shift, ans.size, shift_r) != 0;
+    for (std::size_t i = 0; (i < block_shift) && !inexact; i++)
+        inexact = a.data[i] != 0;
+
+    // Round the magnitude of negative numbers up, as the two's complement
+    // right shift does
+    if (a.sign && inexact && bnl::mpn::add_1(ans.data, ans.data, ans.size, 1)) {
+        ans.size++;
+        ans.data = static_cast<bnl::ulint *>(bnl::realloc(ans.data, ans.size * bnl::ulint_size));
+        ans.data[ans.size - 1] = 1;
+    }
+
+
+    // Shrink and return the answer
+    ans.shrink();
+    return ans;
+}
 
-    // Positive sign
-    if (!a.sign) {
-        // Offset
-        bnl::ulint offset = 0;
 
-        // Right shift main bucle
-        for (std::size_t i = ans.size - 1, j = a.size - 1; i < ans.size; i--, j--) {
-            ans.data[i] = (offset << shift_l) | (a.data[j] >> shift_r);
-            offset = a.data[j] & offset_mask;
+// Input and output
+
+// Standard output, the digits are written in chunks through a fixed buffer
+std::ostream &operator << (std::ostream &stream, const bnl::integer_view &n) {
+    const std::ostream::sentry guard(stream);
+    if (!guard)
+        return stream;
+
+    // Decimal chunks from the least significative. The whole magnitude is
+    // converted before writing, so the frame takes about 0.9 bytes for each
+    // digit besides the temporaries of the conversion, and the scratch stack
+    // keeps that size as its high water mark
+    const bnl::scratch mem(decimal_size(n.size));
+    bnl::ulint *const chunks = mem.data();
+    const std::size_t count = bnl::integer::todecimal(n, chunks);
+
+    // Sign and the most significative chunk without leading zeros
+    char buffer[stream_buffer];
+    std::size_t used = n.sign ? 1 : 0;
+    buffer[0] = '-';
+    used += digits(buffer + used, chunks[count - 1], false);
+
+    // Fill characters up to the field width
+    const std::size_t length = used + (count - 1) * decimal_digits;
+    const std::size_t width = stream.width() > 0 ? static_cast<std::size_t>(stream.width()) : 0;
+    const std::size_t padding = width > length ? width - length : 0;
+    const std::ios_base::fmtflags adjust = stream.flags() & std::ios_base::adjustfield;
+    std::streambuf *const output = stream.rdbuf();
+    bool good = true;
+
+    // Padding after the sign
+    if (padding && (adjust == std::ios_base::internal)) {
+        if (n.sign)
+            good = output->sputc('-') == '-';
+
+        good = good && fill(output, stream.fill(), padding);
+        used = digits(buffer, chunks[count - 1], false);
+    }
+
+    // Padding before the number
+    else if (padding && (adjust != std::ios_base::left))
+        good = fill(output, stream.fill(), padding);
+
+    // The other chunks padded with zeros, flushing the full buffer
+    for (std::size_t i = count - 2; good && (i < count); i--) {
+        if (used + decimal_digits > stream_buffer) {
+            good = output->sputn(buffer, used) == static_cast<std::streamsize>(used);
+            used = 0;
         }
+
+        used += digits(buffer + used, chunks[i], true);
     }
 
-    // Negative sign
-    else {
-        // Carries
-        bnl::ulint carry = 1;
-        bnl::ulint carry_ans = 1;
+    good = good && (output->sputn(buffer, used) == static_cast<std::streamsize>(used));
 
-        // First block
-        bnl::ulint block = (a.data[0] ^ bnl::integer::base_mask) + carry;
+    // Padding after the number
+    if (padding && (adjust == std::ios_base::left))
+        good = good && fill(output, stream.fill(), padding);
 
-        // Check carry
-        if (block >= bnl::integer::base_mask) {
-            carry = 1;
-            block -= bnl::integer::base_mask;
+    stream.width(0);
+    if (!good)
+        stream.setstate(std::ios_base::badbit);
+
+    return stream;
+}
+
+// Standard input, the digits are read from the stream buffer and accumulated
+// in chunks. The decimal part and the exponent are accepted and the value is
+// truncated toward zero. On failure the number is not modified
+std::istream &operator >> (std::istream &stream, bnl::integer &n) {
+    const std::istream::sentry guard(stream);
+    if (!guard)
+        return stream;
+
+    typedef std::istream::traits_type traits;
+    std::streambuf *const input = stream.rdbuf();
+    int c = input->sgetc();
+
+    // Sign
+    const bool sign = c == '-';
+    if ((c == '-') || (c == '+'))
+        c = input->snextc();
+
+    // Full decimal chunks folded into the growing numeric data while they are
+    // fewer than the join threshold, so the extra memory is one machine word.
+    // The longer numbers buffer their chunks from the most significative for
+    // the divide and conquer join, about 0.9 bytes for each digit
+    const std::size_t join = bnl::thresholds().join;
+    bnl::integer ans(1, false);
+    std::size_t blocks = 1;
+    std::size_t folded = 0;
+    std::vector<bnl::ulint> chunks;
+
+    // Integer and decimal digits, decimals counts the digits after the point
+    bnl::ulint chunk = 0;
+    bnl::ulint power = 1;
+    std::size_t count = 0;
+    std::size_t decimals = 0;
+    bool point = false;
+
+    for (;; c = input->snextc()) {
+        if (!point && (c == '.')) {
+            point = true;
+            continue;
         }
 
-        // Reset the carry
-        else carry = 0;
+        if ((c < '0') || (c > '9'))
+            break;
 
-        // Offset
-        bnl::ulint offset = block >> shift_r;
+        chunk = chunk * 10 + (c - '0');
+        power *= 10;
+        count++;
 
-        // Right shift main bucle
-        for (std::size_t i = 0, j = block_shift + 1; j < a.size; i++, j++) {
-            // Two's complement
-            block = (a.data[j] ^ bnl::integer::base_mask) + carry;
+        if (point)
+            decimals++;
 
-            // Check carry
-            if (block >= bnl::integer::base_mask) {
-                carry = 1;
-                block -= bnl::integer::base_mask;
+        // Full chunk
+        if (power == decimal_base) {
+            if (folded < join) {
+                muladd(ans.data, ans.size, blocks, decimal_base, chunk);
+                folded++;
+            }
+            else {
+                // The folded chunks start the buffer
+                if (chunks.empty()) {
+                    chunks.resize(decimal_size(ans.size));
+                    chunks.resize(bnl::integer::todecimal(ans, &chunks[0]));
+                    std::reverse(chunks.begin(), chunks.end());
+                }
+
+                chunks.push_back(chunk);
             }
 
-            // Reset the carry
-            else carry = 0;
+            chunk = 0;
+            power = 1;
+        }
+    }
 
-            // Two's complement of the right shiftment
-            ans.data[i] = ((((block & offset_mask) << shift_l) | (offset >> shift_r)) ^ bnl::integer::base_mask) + carry_ans;
+    // Exponent with optional sign
+    bool valid = count > 0;
+    bool exp_sign = false;
+    bnl::ulint exp = 0;
 
-            // Check carry
-            if (ans.data[i] >= bnl::integer::base_mask) {
-                carry_ans = 1;
-                ans.data[i] -= bnl::integer::base_mask;
-            }
+    if (valid && ((c == 'e') || (c == 'E'))) {
+        c = input->snextc();
+        exp_sign = c == '-';
+        if ((c == '-') || (c == '+'))
+            c = input->snextc();
 
-            // Reset the carry
-            else carry_ans = 0;
+        valid = (c >= '0') && (c <= '9');
+        for (; valid && (c >= '0') && (c <= '9'); c = input->snextc()) {
+            exp = exp * 10 + (c - '0');
 
-            // Offset
-            offset = block;
+            // Exponents beyond any representable number
+            valid = exp < decimal_base * decimal_base;
         }
+    }
 
-        // Fill the last block and two's complement
-        ans.data[ans.size - 1] = (((offset_mask << shift_l) | offset) ^ bnl::integer::base_mask) + carry_ans;
+    if (traits::eq_int_type(c, traits::eof()))
+        stream.setstate(std::ios_base::eofbit);
 
-        // Check carry
-        if (ans.data[ans.size - 1] >= bnl::integer::base_mask) {
-            carry_ans = 1;
-            ans.data[ans.size - 1] -= bnl::integer::base_mask;
-        }
+    if (!valid) {
+        stream.setstate(std::ios_base::failbit);
+        return stream;
     }
 
 
-    // Shrink and return the answer
-    ans.shrink();
-    return ans;
-}
+    // Join the buffered chunks from the least significative
+    if (!chunks.empty()) {
+        std::reverse(chunks.begin(), chunks.end());
+        ans = bnl::integer::fromdecimal(&chunks[0], chunks.size());
+        ans.unshare();
+        blocks = ans.size;
+    }
 
+    // The last digits are accumulated in place
+    if (power > 1)
+        muladd(ans.data, ans.size, blocks, power, chunk);
 
-// Input and output
+    ans.sign = sign;
+    ans.shrink();
 
-// Standard output
-std::ostream &operator << (std::ostream &stream, const bnl::integer &n) {
-    stream << std::string(n);
-    return stream;
-}
+    // Apply the exponent minus the decimal digits
+    static const bnl::integer ten("10");
+    if (!exp_sign && (exp >= decimals)) {
+        if (exp > decimals)
+            ans = ans * bnl::pow(ten, bnl::integer::word(exp - decimals));
+    }
+    else {
+        const bnl::ulint shift = exp_sign ? exp + decimals : decimals - exp;
+        ans = shift < count ? ans / bnl::pow(ten, bnl::integer::word(shift)) : bnl::integer::zero;
+    }
 
-// Standard input
-std::istream &operator >> (std::istream &stream, bnl::integer &n) {
-    // Read the integer
-    std::string str;
-    stream >> str;
-    n = str;
+    // Swap the numeric data
+    std::swap(n.data, ans.data);
+    std::swap(n.size, ans.size);
+    std::swap(n.sign, ans.sign);
 
-    // Return the stream
     return stream;
 }
 
@@ -1059,9 +1168,9 @@ std::istream &operator >> (std::istream &stream, bnl::integer &n) {
 // Comparison and relational operators
 
 // Greater than
-bool operator > (const bnl::integer &a, const bnl::integer &b) {
-    // Same object
-    if (&a == &b)
+bool operator > (const bnl::integer_view &a, const bnl::integer_view &b) {
+    // Same numeric data and sign, the same number or its copies
+    if ((a.data == b.data) && (a.size == b.size) && (a.sign == b.sign))
         return false;
 
     // Zeros
@@ -1107,9 +1216,9 @@ bool operator > (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Less than
-bool operator < (const bnl::integer &a, const bnl::integer &b) {
-    // Same object
-    if (&a == &b)
+bool operator < (const bnl::integer_view &a, const bnl::integer_view &b) {
+    // Same numeric data and sign, the same number or its copies
+    if ((a.data == b.data) && (a.size == b.size) && (a.sign == b.sign))
         return false;
 
     // Zeros
@@ -1155,9 +1264,9 @@ bool operator < (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Equals to
-bool operator == (const bnl::integer &a, const bnl::integer &b) {
-    // Same object
-    if (&a == &b)
+bool operator == (const bnl::integer_view &a, const bnl::integer_view &b) {
+    // Same numeric data and sign, the same number or its copies
+    if ((a.data == b.data) && (a.size == b.size) && (a.sign == b.sign))
         return true;
 
     // Different signs
@@ -1172,7 +1281,9 @@ bool operator == (const bnl::integer &a, const bnl::integer &b) {
 // Bitwise operators
 
 // Bitwise AND
-const bnl::integer operator & (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator & (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_AND, std::max(a.size, b.size));
+
     // Zeros
     if (bnl::iszero(a) || bnl::iszero(b))
         return bnl::integer::zero;
@@ -1180,15 +1291,15 @@ const bnl::integer operator & (const bnl::integer &a, const bnl::integer &b) {
 
     // Netative ones
     if (a.sign && bnl::isone(a))
-        return b;
+        return bnl::integer(b);
 
     if (b.sign && bnl::isone(b))
-        return a;
+        return bnl::integer(a);
 
 
     // Operands and answer variables
-    const bnl::integer &m = a.size >= b.size ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
+    const bnl::integer_view &m = a.size >= b.size ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
     bnl::integer ans(m.size, m.sign && n.sign);
 
     // Auxiliar variables
@@ -1345,26 +1456,28 @@ const bnl::integer operator & (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Bitwise OR (inclusive or)
-const bnl::integer operator | (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator | (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_OR, std::max(a.size, b.size));
+
     // Zeros
     if (bnl::iszero(a))
-        return b;
+        return bnl::integer(b);
 
     if (bnl::iszero(b))
-        return a;
+        return bnl::integer(a);
 
 
     // Netative ones
     if (a.sign && bnl::isone(a))
-        return a;
+        return bnl::integer(a);
 
     if (b.sign && bnl::isone(b))
-        return b;
+        return bnl::integer(b);
 
 
     // Operands and answer variables
-    const bnl::integer &m = a.size >= b.size ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
+    const bnl::integer_view &m = a.size >= b.size ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
     bnl::integer ans(m.size, m.sign || n.sign);
 
     // Auxiliar variables
@@ -1521,26 +1634,28 @@ const bnl::integer operator | (const bnl::integer &a, const bnl::integer &b) {
 }
 
 // Bitwise XOR (exclusive or)
-const bnl::integer operator ^ (const bnl::integer &a, const bnl::integer &b) {
+const bnl::integer operator ^ (const bnl::integer_view &a, const bnl::integer_view &b) {
+    BNL_STAT(bnl::STAT_XOR, std::max(a.size, b.size));
+
     // Zeros
     if (bnl::iszero(a))
-        return b;
+        return bnl::integer(b);
 
     if (bnl::iszero(b))
-        return a;
+        return bnl::integer(a);
 
 
     // Netative ones
     if (a.sign && bnl::isone(a))
-        return ~b;
+        return ~bnl::integer(b);
 
     if (b.sign && bnl::isone(b))
-        return ~a;
+        return ~bnl::integer(a);
 
 
     // Operands and answer variables
-    const bnl::integer &m = a.size >= b.size ? a : b;
-    const bnl::integer &n = &m == &a ? b : a;
+    const bnl::integer_view &m = a.size >= b.size ? a : b;
+    const bnl::integer_view &n = &m == &a ? b : a;
     bnl::integer ans(m.size, m.sign ^ n.sign);
 
     // Auxiliar variables
@@ -1725,12 +1840,11 @@ const bnl::integer operator ^ (const bnl::integer &a, const bnl::integer &b) {
 
 // Direct assignation
 bnl::integer &bnl::integer::operator = (const bnl::integer &n) {
-    // Copy attributes if is not the same number
-    if ((this != &n) && (*this != n)) {
+    // Share the numeric data if is not the same number
+    if (this != &n) {
+        data = static_cast<bnl::ulint *>(bnl::assign(data, n.data));
         size = n.size;
         sign = n.sign;
-        data = static_cast<bnl::ulint *>(std::realloc(data, size * bnl::ulint_size));
-        bnl::integer::cpy(data, n.data, size);
     }
 
     // Return the number
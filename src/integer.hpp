@@ -1,17 +1,33 @@
 #ifndef __BNL_INTEGER_HPP_
 #define __BNL_INTEGER_HPP_
 
-#include "bnl.hpp" // bnl::ulint, bnl::ulint_size, bnl::ldouble
+#include "bnl.hpp"       // bnl::ulint, bnl::lint, bnl::ulint_size, bnl::ldouble, bnl::endian
+#include "allocator.hpp" // bnl::malloc, bnl::calloc, bnl::realloc, bnl::free, bnl::share, bnl::assign, bnl::unshare
+#include "view.hpp"      // bnl::integer_view
 
 #include <sstream> // std::stringstream, std::istream, std::ostream
 #include <string>  // std::string
-#include <cstdlib> // std::malloc, std::calloc, std::realloc, std::free
+#include <vector>  // std::vector
 
 
-// Forward declaration of the bnl::integer class and bnl::div_t struct
+// Forward declaration of the bnl::integer class, bnl::div_t struct and friend
+// classes
 namespace bnl {
     class integer;
+    class integer_view;
     struct div_t;
+    struct gcdext_t;
+    struct sqrtrem_t;
+    struct fib2_t;
+
+    class barrett;
+    class crt;
+    class mapped;
+    class radix;
+    class rational;
+
+    template <std::size_t Bits, bool Signed>
+    class fixed;
 }
 
 
@@ -84,11 +100,26 @@ namespace bnl {
             // Static methods
 
             // Compare and returns -1 if a < b, 0 if a == b, and 1 if a > b
-            static int cmp(const bnl::integer &a, const bnl::integer &b);
+            static int cmp(const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Compare the magnitudes and returns -1 if |a| < |b|, 0 if |a| == |b|, and 1 if |a| > |b|
+            static int cmpabs(const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Copy n data blocks of numeric data from source to destiny
             static void cpy(bnl::ulint *const dest, const bnl::ulint *const src, const std::size_t &n);
 
+            // Long division of the magnitudes with |a| >= |b| > 0
+            static void divrem(const bnl::integer_view &a, const bnl::integer_view &b, bnl::integer &quot, bnl::integer &rem);
+
+            // Square of the magnitude
+            static const bnl::integer sqr(const bnl::integer_view &n);
+
+            // Lehmer's steps over x >= y >= 0 while y is larger than the given size
+            static void lehmer(bnl::integer &x, bnl::integer &y, const std::size_t &size, bnl::integer *const s0 = NULL, bnl::integer *const s1 = NULL);
+
+            // Sum written over the numeric data of the answer, that may be one of the operands
+            static void addto(const bnl::integer &a, const bnl::integer &b, bnl::integer &ans);
+
             // Returns whether the given character if the point character
             static bool isexp(const char &c);
 
@@ -101,6 +132,15 @@ namespace bnl {
             // Returns whether the given character if a sign character
             static bool issign(const char &c);
 
+            // Integer from the magnitude of a machine word and a sign
+            static const bnl::integer word(const bnl::ulint &n, const bool &sign = false);
+
+            // Decimal chunks of 9 digits of the magnitude from the least significative, returns the number of chunks
+            static std::size_t todecimal(const bnl::integer_view &n, bnl::ulint *const chunks);
+
+            // Magnitude from its decimal chunks of 9 digits from the least significative
+            static const bnl::integer fromdecimal(const bnl::ulint *const chunks, const std::size_t &count);
+
 
             // Constructors
 
@@ -116,6 +156,9 @@ namespace bnl {
             // Shrink numeric data
             void shrink();
 
+            // Copy the numeric data if it is shared, before it is modified
+            void unshare();
+
 
 
         public:
@@ -145,6 +188,9 @@ namespace bnl {
             // Integer division
             static const bnl::div_t div(const bnl::integer &a, const bnl::integer &b);
 
+            // Integer division of views
+            static const bnl::div_t div(const bnl::integer_view &a, const bnl::integer_view &b);
+
 
             // Constructors
 
@@ -163,6 +209,35 @@ namespace bnl {
             // Constructor from long double
             integer(const bnl::ldouble &n);
 
+            // Constructor from a view, sharing the numeric data of a whole
+            // number
+            explicit integer(const bnl::integer_view &n);
+
+
+            // Friend classes
+
+            // Barrett reduction context
+            friend class bnl::barrett;
+
+            // Chinese Remainder Theorem engine
+            friend class bnl::crt;
+
+            // Integer stored in a memory mapped file
+            friend class bnl::mapped;
+
+            // Divide and conquer decimal conversion context
+            friend class bnl::radix;
+
+            // Fraction of arbitrary precision integers
+            friend class bnl::rational;
+
+            // Fixed width integers
+            template <std::size_t Bits, bool Signed>
+            friend class bnl::fixed;
+
+            // Read-only view of numeric data
+            friend class bnl::integer_view;
+
 
             // Methods
 
@@ -199,7 +274,98 @@ namespace bnl {
 
 
             // Get the string representation with the given radix
-            friend const std::string str(const bnl::integer &n, const int &radix);
+            friend const std::string str(const bnl::integer_view &n, const int &radix);
+
+
+            // Returns the greatest common divisor of two numbers
+            friend const bnl::integer gcd(const bnl::integer &a, const bnl::integer &b);
+
+            // Returns the least common multiple of two numbers
+            friend const bnl::integer lcm(const bnl::integer &a, const bnl::integer &b);
+
+            // Returns the greatest common divisor and the Bezout coefficients
+            friend const bnl::gcdext_t gcdext(const bnl::integer &a, const bnl::integer &b);
+
+
+            // Returns the integer square root
+            friend const bnl::integer sqrt(const bnl::integer &n);
+
+            // Returns the integer square root and the remainder
+            friend const bnl::sqrtrem_t sqrtrem(const bnl::integer &n);
+
+            // Returns the integer k-th root
+            friend const bnl::integer root(const bnl::integer &n, const bnl::ulint &k);
+
+            // Returns whether the value is a perfect square
+            friend bool is_perfect_square(const bnl::integer &n);
+
+            // Returns whether the value is a perfect power
+            friend bool is_perfect_power(const bnl::integer &n);
+
+
+            // Returns whether the value is a probable prime
+            friend bool is_probable_prime(const bnl::integer &n, const std::size_t &reps);
+
+            // Returns the smallest prime greater than the value
+            friend const bnl::integer next_prime(const bnl::integer &n);
+
+
+            // Returns the factorial of n
+            friend const bnl::integer factorial(const bnl::ulint &n);
+
+            // Returns the multifactorial n (n - k) (n - 2k) ... of step k
+            friend const bnl::integer multifactorial(const bnl::ulint &n, const bnl::ulint &k);
+
+            // Returns the binomial coefficient C(n, k)
+            friend const bnl::integer binomial(const bnl::ulint &n, const bnl::ulint &k);
+
+            // Returns the product of the primes lower than or equal to n
+            friend const bnl::integer primorial(const bnl::ulint &n);
+
+
+            // Returns the Fibonacci numbers F(n) and F(n - 1)
+            friend const bnl::fib2_t fib2(const bnl::ulint &n);
+
+
+            // Export the magnitude to words of the given size in bytes
+            friend const std::vector<bnl::uchar> export_bytes(const bnl::integer &n, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes);
+
+            // Import a positive number from the given number of words of the given size
+            friend const bnl::integer import_bytes(const bnl::uchar *const data, const std::size_t &count, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes);
+
+            // Size in bytes of the wire format
+            friend std::size_t wire_size(const bnl::integer &n);
+
+            // Write the header and the numeric data to the buffer
+            friend std::size_t wire_write(const bnl::integer &n, bnl::uchar *const buffer);
+
+            // Read a number from a buffer of the given size in bytes
+            friend const bnl::integer wire_read(const bnl::uchar *const buffer, const std::size_t &size, std::size_t *const used);
+
+            // Write the header and the numeric data to the stream
+            friend std::ostream &wire_write(std::ostream &stream, const bnl::integer &n);
+
+            // Read a number from the stream
+            friend std::istream &wire_read(std::istream &stream, bnl::integer &n);
+
+
+            // Sum of each number and a constant
+            friend void batch_add(const bnl::integer *const a, const bnl::integer &b, bnl::integer *const ans, const std::size_t &count);
+
+            // Sum of the numbers of the same index
+            friend void batch_add(const bnl::integer *const a, const bnl::integer *const b, bnl::integer *const ans, const std::size_t &count);
+
+            // Product of each number by a machine word
+            friend void batch_mul_scalar(const bnl::integer *const a, const bnl::lint &k, bnl::integer *const ans, const std::size_t &count);
+
+            // Remainder of each number divided by the modulus of a Barrett context
+            friend void batch_mod(const bnl::integer *const a, const bnl::barrett &m, bnl::integer *const ans, const std::size_t &count);
+
+            // Compare each number with a constant
+            friend void batch_cmp(const bnl::integer *const a, const bnl::integer &b, int *const ans, const std::size_t &count);
+
+            // Compare the numbers of the same index
+            friend void batch_cmp(const bnl::integer *const a, const bnl::integer *const b, int *const ans, const std::size_t &count);
 
 
             // Operators overloading
@@ -253,31 +419,31 @@ namespace bnl {
             // Arithmetic operators
 
             // Multiplication
-            friend const bnl::integer (::operator *) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator *) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Division
-            friend const bnl::integer (::operator /) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator /) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Modulo
-            friend const bnl::integer (::operator %) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator %) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Addition
-            friend const bnl::integer (::operator +) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator +) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Subtraction
-            friend const bnl::integer (::operator -) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator -) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Left shift
-            friend const bnl::integer (::operator <<) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator <<) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Right shift
-            friend const bnl::integer (::operator >>) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator >>) (const bnl::integer_view &a, const bnl::integer_view &b);
 
 
             // Input and output
 
             // Standard output
-            friend std::ostream &::operator << (std::ostream &stream, const bnl::integer &n);
+            friend std::ostream &::operator << (std::ostream &stream, const bnl::integer_view &n);
 
             // Standard input
             friend std::istream &::operator >> (std::istream &stream, bnl::integer &n);
@@ -286,34 +452,25 @@ namespace bnl {
             // Comparison and relational operators
 
             // Greater than
-            friend bool ::operator > (const bnl::integer &a, const bnl::integer &b);
+            friend bool ::operator > (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Less than
-            friend bool ::operator < (const bnl::integer &a, const bnl::integer &b);
-
-            // Greater than or equal to
-            friend bool ::operator >= (const bnl::integer &a, const bnl::integer &b);
-
-            // Less than or equal to
-            friend bool ::operator <= (const bnl::integer &a, const bnl::integer &b);
+            friend bool ::operator < (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Equal to
-            friend bool ::operator == (const bnl::integer &a, const bnl::integer &b);
-
-            // Not equal to
-            friend bool ::operator != (const bnl::integer &a, const bnl::integer &b);
+            friend bool ::operator == (const bnl::integer_view &a, const bnl::integer_view &b);
 
 
             // Bitwise operators
 
             // Bitwise AND
-            friend const bnl::integer (::operator &) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator &) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Bitwise OR (inclusive or)
-            friend const bnl::integer (::operator |) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator |) (const bnl::integer_view &a, const bnl::integer_view &b);
 
             // Bitwise XOR (exclusive or)
-            friend const bnl::integer (::operator ^) (const bnl::integer &a, const bnl::integer &b);
+            friend const bnl::integer (::operator ^) (const bnl::integer_view &a, const bnl::integer_view &b);
 
 
             // Logic operators
@@ -385,7 +542,7 @@ namespace bnl {
 
             // Integer destructor
             inline ~integer() {
-                std::free(data);
+                bnl::free(data);
                 data = NULL;
                 size = 0;
                 sign = false;
@@ -448,10 +605,63 @@ namespace bnl {
     inline const bnl::integer &min(const bnl::integer &a, const bnl::integer &b) {
         return a < b ? a : b;
     }
+
+    // Other helpful functions
+    inline std::string const str(const bnl::integer &n, const int &radix) {
+        return bnl::str(bnl::integer_view(n), radix);
+    }
+}
+
+
+// Arithmetic operators, over the views of the numbers
+inline const bnl::integer operator * (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) * bnl::integer_view(b);
+}
+
+inline const bnl::integer operator / (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer::div(a, b).quot;
+}
+
+inline const bnl::integer operator % (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer::div(a, b).rem;
+}
+
+inline const bnl::integer operator + (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) + bnl::integer_view(b);
+}
+
+inline const bnl::integer operator - (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) - bnl::integer_view(b);
+}
+
+inline const bnl::integer operator << (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) << bnl::integer_view(b);
+}
+
+inline const bnl::integer operator >> (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) >> bnl::integer_view(b);
+}
+
+
+// Output
+inline std::ostream &operator << (std::ostream &stream, const bnl::integer &n) {
+    return stream << bnl::integer_view(n);
 }
 
 
 // Comparison and relational operators
+inline bool operator > (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) > bnl::integer_view(b);
+}
+
+inline bool operator < (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) < bnl::integer_view(b);
+}
+
+inline bool operator == (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) == bnl::integer_view(b);
+}
+
 inline bool operator >= (const bnl::integer &a, const bnl::integer &b) {
     return !(a < b);
 }
@@ -465,6 +675,20 @@ inline bool operator != (const bnl::integer &a, const bnl::integer &b) {
 }
 
 
+// Bitwise operators
+inline const bnl::integer operator & (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) & bnl::integer_view(b);
+}
+
+inline const bnl::integer operator | (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) | bnl::integer_view(b);
+}
+
+inline const bnl::integer operator ^ (const bnl::integer &a, const bnl::integer &b) {
+    return bnl::integer_view(a) ^ bnl::integer_view(b);
+}
+
+
 // Logic operators
 inline bool operator && (const bnl::integer &a, const bnl::integer &b) {
     return (a != bnl::integer::zero) && (b != bnl::integer::zero);
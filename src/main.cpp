@@ -1,5 +1,25 @@
 #include "integer.hpp"
+#include "barrett.hpp"
+#include "gcd.hpp"
+#include "crt.hpp"
+#include "root.hpp"
+#include "prime.hpp"
+#include "factorial.hpp"
+#include "fibonacci.hpp"
+#include "serialize.hpp"
+#include "allocator.hpp"
+#include "parallel.hpp"
+#include "batch.hpp"
+#include "accumulator.hpp"
+#include "fixed.hpp"
+#include "view.hpp"
+#include "mpn.hpp"
+#include "hash.hpp"
+#include "rational.hpp"
+#include "tuning.hpp"
+#include "stats.hpp"
 #include <iostream>
+#include <iomanip>
 #include <string>
 
 int main() {
@@ -56,7 +76,157 @@ int main() {
     std::cout << "                " << bnl::abs(-a) << std::endl;
     std::cout << "Maximum:        " << bnl::max(a, b) << std::endl;
     std::cout << "Minimum:        " << bnl::min(a, b) << std::endl;
-    std::cout << "Power:          " << bnl::pow(a, bnl::integer("8")) << std::endl;
+    std::cout << "Power:          " << bnl::pow(a, bnl::integer("8")) << std::endl << std::endl;
+
+    // Barrett reduction
+    const bnl::barrett m(b);
+    std::cout << "Barrett modulo: " << (a * a) % m << std::endl;
+    std::cout << "                " << (-a * a) % m << std::endl << std::endl;
+
+    // Greatest common divisor
+    const bnl::gcdext_t e = bnl::gcdext(a, b);
+    std::cout << "GCD:            " << bnl::gcd(a, b) << std::endl;
+    std::cout << "LCM:            " << bnl::lcm(a, b) << std::endl;
+    std::cout << "Bezout:         " << e.gcd << " = " << e.s << " * a + " << e.t << " * b" << std::endl;
+    std::cout << "Inverse:        " << bnl::invert(a, b) << std::endl << std::endl;
+
+    // Chinese Remainder Theorem
+    std::vector<bnl::ulint> moduli;
+    moduli.push_back(4294967291);
+    moduli.push_back(4294967279);
+    moduli.push_back(4294967231);
+    moduli.push_back(4294967197);
+    const bnl::crt c(moduli);
+    std::cout << "CRT:            " << c.reconstruct(c.residues(a * -b), true) << std::endl << std::endl;
+
+    // Roots
+    std::cout << "Square root:    " << bnl::sqrt(a) << std::endl;
+    std::cout << "Cube root:      " << bnl::root(-a, 3) << std::endl;
+    std::cout << "Perfect square: " << bnl::is_perfect_square(a * a) << std::endl;
+    std::cout << "Perfect power:  " << bnl::is_perfect_power(b * b * b) << std::endl << std::endl;
+
+    // Primes
+    std::cout << "Modular power:  " << bnl::powmod(a, b, a + b) << std::endl;
+    std::cout << "Probable prime: " << bnl::is_probable_prime(a) << std::endl;
+    std::cout << "Next prime:     " << bnl::next_prime(a) << std::endl << std::endl;
+
+    // Combinatorics
+    std::cout << "Factorial:      " << bnl::factorial(30) << std::endl;
+    std::cout << "Double fact.:   " << bnl::multifactorial(31, 2) << std::endl;
+    std::cout << "Large step:     " << bnl::multifactorial(6148914691236517207UL, 6148914691236517204UL) << std::endl;
+    std::cout << "Binomial:       " << bnl::binomial(100, 50) << std::endl;
+    std::cout << "Primorial:      " << bnl::primorial(100) << std::endl << std::endl;
+
+    // Fibonacci and Lucas numbers
+    const bnl::fib2_t f = bnl::fib2(150);
+    std::cout << "Fibonacci:      " << f.fib << std::endl;
+    std::cout << "                " << f.prev << std::endl;
+    std::cout << "Lucas:          " << bnl::lucas(150) << std::endl << std::endl;
+
+    // Binary serialization
+    const std::vector<bnl::uchar> bytes = bnl::export_bytes(a);
+    std::cout << "Export bytes:   " << std::hex << std::setfill('0');
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        std::cout << std::setw(2) << static_cast<int>(bytes[i]);
+    std::cout << std::dec << std::endl;
+    std::cout << "Import bytes:   " << bnl::import_bytes(bytes) << std::endl;
+
+    std::stringstream wire;
+    bnl::integer w;
+    bnl::wire_write(wire, -a);
+    bnl::wire_read(wire, w);
+    std::cout << "Wire format:    " << w << " (" << bnl::wire_size(w) << " bytes)" << std::endl << std::endl;
+
+    // Streaming decimal input and output
+    std::istringstream input("  -1234567890123456789.75e3 tail");
+    bnl::integer s;
+    input >> s;
+    std::cout << "Stream input:   " << s << std::endl;
+    std::cout << "Stream output:  [" << std::setfill('.') << std::setw(32) << std::internal << s << "]" << std::endl << std::endl;
+
+    // Fixed width integers, wrapping modulo 2^Bits
+    const bnl::fixed<128> x = ~bnl::fixed<128>();
+    const bnl::fixed<256, true> y = -(bnl::fixed<256, true>(a) << 100);
+    std::cout << "Fixed:          " << x << " + 1 = " << x + 1 << std::endl;
+    std::cout << "                " << y << " / " << b << " = " << y / bnl::fixed<256, true>(b) << std::endl << std::endl;
+
+    // Read-only view of external data blocks, computed without copying them
+    const bnl::ulint blocks[] = {0x89abcdef, 0x01234567, 0};
+    const bnl::integer_view view(blocks, 3);
+    std::cout << "Integer view:   " << view << " squared " << view * view << std::endl;
+    std::cout << "                " << -view.high(1) << " + " << a << " = " << -view.high(1) + a << std::endl << std::endl;
+
+    // Low level kernels over the same data blocks, without numbers
+    bnl::ulint sum[3];
+    sum[2] = bnl::mpn::mul_1(sum, blocks, 2, 3);
+    sum[2] += bnl::mpn::addmul_1(sum, blocks, 2, 5);
+    std::cout << "Kernels:        3 v + 5 v = " << bnl::integer_view(sum, 3) << " = " << (view << bnl::integer("3")) << std::endl << std::endl;
+
+    // Hash of the value, computed once for the keys of the hash containers
+    const bnl::hashed key = a * b;
+    std::cout << "Hash:           " << std::hex << key.hash() << std::dec << ", " << (bnl::hash(b * a) == key.hash() ? "same" : "different") << " for b * a, " << (bnl::hash(-(a * b)) == key.hash() ? "same" : "different") << " for -(a * b)" << std::endl << std::endl;
+
+    // Exact fractions, reduced lazily: the harmonic number H(50)
+    bnl::rational h;
+    for (int k = 1; k <= 50; k++)
+        h += bnl::rational(bnl::integer::one, k);
+    std::cout << "Rational:       " << h << ", " << (h * bnl::rational("3/4") < bnl::rational(a, b) ? "less" : "greater") << " than a / b" << std::endl << std::endl;
+
+    // Batch arithmetic, in place over the same array
+    bnl::integer batch[4] = {a, b, -a, f.fib};
+    int order[4];
+    bnl::batch_mul_scalar(batch, -3, batch, 4);
+    bnl::batch_add(batch, bnl::integer::one, batch, 4);
+    bnl::batch_mod(batch, bnl::integer("1000000007"), batch, 4);
+    bnl::batch_cmp(batch, bnl::integer::zero, order, 4);
+    std::cout << "Batch:         ";
+    for (std::size_t i = 0; i < 4; i++)
+        std::cout << " " << batch[i] << " (" << order[i] << ")";
+    std::cout << std::endl << std::endl;
+
+    // Sum of many values with deferred carries, merged with another sum
+    bnl::accumulator total, part;
+    for (std::size_t i = 0; i < 1000000; i++) {
+        total += a;
+        part -= b;
+    }
+    total += part;
+    std::cout << "Accumulator:    " << total.value() << " = " << (a - b) * bnl::integer("1000000") << std::endl << std::endl;
+
+    // Arena allocator, the result is copied out of the scope before the reset
+    bnl::arena arena;
+    bnl::integer r;
+    {
+        const bnl::allocator::scope scope(arena);
+        r = bnl::factorial(200) / bnl::binomial(200, 100);
+    }
+    std::cout << "Arena:          " << r << std::endl;
+    std::cout << "                " << arena.used() << " of " << arena.capacity() << " bytes used" << std::endl;
+    std::cout << "Scratch stack:  " << bnl::scratch::capacity() << " bytes" << std::endl;
+    arena.reset();
+
+    // Parallel multiplication, checked against the sequential product
+    const bnl::integer big = bnl::factorial(20000);
+    const bnl::integer sequential = big * (big + 1);
+    bnl::set_workers(4);
+    bnl::set_parallel_threshold(1024);
+    std::cout << "Parallel:       " << (big * (big + 1) == sequential ? "same product" : "different product") << " with " << bnl::workers() << " workers" << std::endl;
+
+    // Divide and conquer decimal conversion, read back from its digits
+    const std::string digits = bnl::str(big);
+    std::cout << "Decimal:        " << digits.size() << " digits, " << (bnl::integer(digits) == big ? "same number" : "different number") << " read back" << std::endl;
+    bnl::set_workers(1);
+
+    // Algorithm thresholds, tuned for the host by make tune
+    const bnl::thresholds_t &thresholds = bnl::thresholds();
+    std::cout << "Thresholds:     Karatsuba from " << thresholds.karatsuba_mul << " blocks, NTT from " << thresholds.ntt_mul << " blocks" << std::endl;
+
+    // Instrumentation counters, only counted when built with make STATS=1
+    const bnl::stats_t stats = bnl::stats();
+    if (stats.enabled)
+        std::cout << "Stats:          " << stats.entries[bnl::STAT_MUL].calls << " products, " << stats.bytes << " bytes reserved" << std::endl;
+    else
+        std::cout << "Stats:          disabled" << std::endl;
 
     return 0;
 }
@@ -0,0 +1,348 @@
+#include "mapped.hpp"
+
+#include <stdexcept> // std::invalid_argument, std::runtime_error
+#include <cstring>   // std::memcpy
+
+#include <sys/mman.h> // mmap, munmap, msync, posix_madvise
+#include <sys/stat.h> // fstat
+#include <fcntl.h>    // open
+#include <unistd.h>   // close, ftruncate
+
+
+// Private methods
+
+// Resize the file and the mapping to the given size in data blocks
+void bnl::mapped::remap(const std::size_t &blocks) {
+    // Release the previous mapping
+    if (map)
+        munmap(map, (capacity + 1) * bnl::ulint_size);
+
+    map = NULL;
+    capacity = blocks;
+
+    // The new blocks of a larger file are filled with zeros
+    const std::size_t bytes = (blocks + 1) * bnl::ulint_size;
+    if (writable && ftruncate(fd, bytes))
+        throw std::runtime_error("can't resize bnl::mapped: ftruncate failed");
+
+    // Lazy mapping, the pages are loaded when accessed
+    void *const ptr = mmap(NULL, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED)
+        throw std::runtime_error("can't map bnl::mapped: mmap failed");
+
+    map = static_cast<bnl::ulint *>(ptr);
+    posix_madvise(ptr, bytes, POSIX_MADV_SEQUENTIAL);
+}
+
+// Remove the leading zero blocks and write the header
+void bnl::mapped::shrink() {
+    const bnl::ulint *const n_data = data();
+    while ((size > 1) && !n_data[size - 1])
+        size--;
+
+    // Zero is always positive
+    if ((size == 1) && !n_data[0])
+        sign = false;
+
+    if (size < capacity)
+        remap(size);
+
+    map[0] = (static_cast<bnl::ulint>(size) << 1) | (sign ? 1 : 0);
+}
+
+// Check whether the file is opened for writing
+void bnl::mapped::check(const char *const operation) const {
+    if (!writable)
+        throw std::invalid_argument(std::string("can't ") + operation + " bnl::mapped: file opened as read only");
+}
+
+// Compare the magnitudes and returns -1 if |this| < |n|, 0 if |this| == |n|, and 1 if |this| > |n|
+int bnl::mapped::cmpabs(const bnl::ulint *const n_data, const std::size_t &n_size) const {
+    // Check sizes
+    if (size != n_size)
+        return size < n_size ? -1 : 1;
+
+    // Compare each data block from the most significative
+    const bnl::ulint *const m_data = data();
+    for (std::size_t i = size - 1; i < size; i--)
+        if (m_data[i] != n_data[i])
+            return m_data[i] < n_data[i] ? -1 : 1;
+
+    return 0;
+}
+
+// Compare and returns -1 if this < n, 0 if this == n, and 1 if this > n
+int bnl::mapped::cmp(const bnl::ulint *const n_data, const std::size_t &n_size, const bool &n_sign) const {
+    // Different signs, zero is always positive
+    if (sign != n_sign)
+        return sign ? -1 : 1;
+
+    const int ans = cmpabs(n_data, n_size);
+    return sign ? -ans : ans;
+}
+
+// Add a signed number in place
+void bnl::mapped::add(const bnl::ulint *const n_data, const std::size_t &n_size, const bool &n_sign) {
+    const std::size_t old = size;
+
+    // Same signs, add the magnitudes
+    if (sign == n_sign) {
+        size = (old > n_size ? old : n_size) + 1;
+        if (size > capacity)
+            remap(size);
+
+        // Stop when the number is consumed and there is no carry
+        bnl::ulint *const m_data = data();
+        bnl::ulint carry = 0;
+        for (std::size_t i = 0; (i < n_size) || carry; i++) {
+            const bnl::ulint sum = (i < old ? m_data[i] : 0) + (i < n_size ? n_data[i] : 0) + carry;
+            m_data[i] = sum & bnl::integer::base_mask;
+            carry = sum >> 32;
+        }
+    }
+
+    // Different signs, subtract the smaller magnitude from the larger
+    else if (cmpabs(n_data, n_size) >= 0) {
+        bnl::ulint *const m_data = data();
+        bnl::ulint borrow = 0;
+        for (std::size_t i = 0; (i < n_size) || borrow; i++) {
+            const bnl::ulint diff = m_data[i] - (i < n_size ? n_data[i] : 0) - borrow;
+            m_data[i] = diff & bnl::integer::base_mask;
+            borrow = diff >> 63;
+        }
+    }
+    else {
+        size = n_size;
+        if (size > capacity)
+            remap(size);
+
+        bnl::ulint *const m_data = data();
+        bnl::ulint borrow = 0;
+        for (std::size_t i = 0; i < n_size; i++) {
+            const bnl::ulint diff = n_data[i] - (i < old ? m_data[i] : 0) - borrow;
+            m_data[i] = diff & bnl::integer::base_mask;
+            borrow = diff >> 63;
+        }
+
+        sign = n_sign;
+    }
+
+    shrink();
+}
+
+
+// Constructors
+
+// Open an existing file
+bnl::mapped::mapped(const std::string &path, const bool &writable) : fd(-1), map(NULL), capacity(0), size(0), sign(false), writable(writable) {
+    fd = open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+        throw std::invalid_argument("can't open bnl::mapped: " + path);
+
+    // Check the file size against the header before mapping it
+    struct stat info;
+    bnl::ulint header = 0;
+    if (fstat(fd, &info) || (static_cast<std::size_t>(info.st_size) < 2 * bnl::ulint_size) || (pread(fd, &header, bnl::ulint_size, 0) != static_cast<ssize_t>(bnl::ulint_size)) || !(header >> 1) || ((header >> 1) + 1 != static_cast<std::size_t>(info.st_size) / bnl::ulint_size)) {
+        close(fd);
+        throw std::invalid_argument("can't open bnl::mapped: invalid wire format in " + path);
+    }
+
+    size = header >> 1;
+    sign = header & 1;
+    capacity = size;
+
+    try {
+        remap(size);
+    }
+    catch (...) {
+        close(fd);
+        throw;
+    }
+}
+
+// Create or truncate a file with the given number
+bnl::mapped::mapped(const std::string &path, const bnl::integer &n) : fd(-1), map(NULL), capacity(0), size(n.size), sign(n.sign), writable(true) {
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw std::invalid_argument("can't create bnl::mapped: " + path);
+
+    try {
+        remap(size);
+    }
+    catch (...) {
+        close(fd);
+        throw;
+    }
+
+    // Header and numeric data
+    map[0] = (static_cast<bnl::ulint>(size) << 1) | (sign ? 1 : 0);
+    std::memcpy(data(), n.data, size * bnl::ulint_size);
+}
+
+
+// Destructor
+bnl::mapped::~mapped() {
+    if (map)
+        munmap(map, (capacity + 1) * bnl::ulint_size);
+
+    close(fd);
+}
+
+
+// Methods
+
+// The number copied to the heap
+const bnl::integer bnl::mapped::load() const {
+    bnl::integer ans(size, sign);
+    std::memcpy(ans.data, data(), size * bnl::ulint_size);
+
+    return ans;
+}
+
+// The number viewed in place, the mapped data is already normalized
+const bnl::integer_view bnl::mapped::view() const {
+    return bnl::integer_view(data(), size, sign, false);
+}
+
+// Flush the changes to the file
+void bnl::mapped::sync() const {
+    if (writable)
+        msync(map, (capacity + 1) * bnl::ulint_size, MS_SYNC);
+}
+
+// Compare and returns -1 if this < n, 0 if this == n, and 1 if this > n
+int bnl::mapped::compare(const bnl::integer &n) const {
+    return cmp(n.data, n.size, n.sign);
+}
+
+int bnl::mapped::compare(const bnl::mapped &n) const {
+    return cmp(n.data(), n.size, n.sign);
+}
+
+
+// Assignment operators
+
+// Assignation by addition
+bnl::mapped &bnl::mapped::operator += (const bnl::integer &n) {
+    check("add to");
+    add(n.data, n.size, n.sign);
+
+    return *this;
+}
+
+bnl::mapped &bnl::mapped::operator += (const bnl::mapped &n) {
+    check("add to");
+
+    // The numeric data would be remapped while it is read
+    if (&n == this)
+        return *this <<= 1;
+
+    add(n.data(), n.size, n.sign);
+    return *this;
+}
+
+// Assignation by subtraction
+bnl::mapped &bnl::mapped::operator -= (const bnl::integer &n) {
+    check("subtract from");
+    add(n.data, n.size, !n.sign && !bnl::iszero(n));
+
+    return *this;
+}
+
+bnl::mapped &bnl::mapped::operator -= (const bnl::mapped &n) {
+    check("subtract from");
+
+    // Zero
+    if (&n == this) {
+        size = 1;
+        sign = false;
+        data()[0] = 0;
+        shrink();
+
+        return *this;
+    }
+
+    add(n.data(), n.size, !n.sign && ((n.size > 1) || n.data()[0]));
+    return *this;
+}
+
+// Assignation by left shift
+bnl::mapped &bnl::mapped::operator <<= (const bnl::ulint &bits) {
+    check("shift");
+
+    const std::size_t blocks = bits >> 5;
+    const std::size_t shift = bits & 31;
+    const std::size_t old = size;
+
+    // Grow the file, the new blocks are filled with zeros
+    size = old + blocks + 1;
+    if (size > capacity)
+        remap(size);
+
+    // Move each data block from the most significative
+    bnl::ulint *const m_data = data();
+    for (std::size_t i = size - 1; i >= blocks && i < size; i--) {
+        const std::size_t j = i - blocks;
+        const bnl::ulint high = j < old ? m_data[j] << shift : 0;
+        const bnl::ulint low = j && shift && (j - 1 < old) ? m_data[j - 1] >> (32 - shift) : 0;
+        m_data[i] = (high | low) & bnl::integer::base_mask;
+    }
+
+    for (std::size_t i = 0; i < blocks; i++)
+        m_data[i] = 0;
+
+    shrink();
+    return *this;
+}
+
+// Assignation by right shift, rounding toward negative infinity
+bnl::mapped &bnl::mapped::operator >>= (const bnl::ulint &bits) {
+    check("shift");
+
+    const std::size_t blocks = bits >> 5;
+    const std::size_t shift = bits & 31;
+    bnl::ulint *const m_data = data();
+
+    // Whether any discarded bit is set, so a negative number is rounded down
+    bool inexact = false;
+    for (std::size_t i = 0; (i < blocks) && (i < size) && !inexact; i++)
+        inexact = m_data[i] != 0;
+
+    if (!inexact && (blocks < size))
+        inexact = (m_data[blocks] & ((static_cast<bnl::ulint>(1) << shift) - 1)) != 0;
+
+    // All the bits are discarded, zero or minus one
+    if (blocks >= size) {
+        size = 1;
+        m_data[0] = sign ? 1 : 0;
+        shrink();
+
+        return *this;
+    }
+
+    // Move each data block from the least significative
+    const std::size_t count = size - blocks;
+    for (std::size_t i = 0; i < count; i++) {
+        const bnl::ulint low = m_data[i + blocks] >> shift;
+        const bnl::ulint high = shift && (i + blocks + 1 < size) ? m_data[i + blocks + 1] << (32 - shift) : 0;
+        m_data[i] = (low | high) & bnl::integer::base_mask;
+    }
+
+    size = count;
+
+    // Round the magnitude of negative numbers up
+    if (sign && inexact) {
+        bnl::ulint carry = 1;
+        for (std::size_t i = 0; carry && (i < size); i++) {
+            const bnl::ulint sum = m_data[i] + carry;
+            m_data[i] = sum & bnl::integer::base_mask;
+            carry = sum >> 32;
+        }
+
+        if (carry)
+            m_data[size++] = carry;
+    }
+
+    shrink();
+    return *this;
+}
@@ -0,0 +1,132 @@
+#ifndef __BNL_MAPPED_HPP_
+#define __BNL_MAPPED_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::integer_view, bnl::ulint
+
+#include <cstddef> // std::size_t
+#include <string>  // std::string
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Integer stored in a memory mapped file with the wire format
+    class mapped {
+        private:
+            // Attributes
+
+            // File descriptor
+            int fd;
+
+            // Mapped file, the wire format header followed by the numeric data
+            bnl::ulint *map;
+
+            // Mapped size in data blocks, without the header
+            std::size_t capacity;
+
+            // Numeric data array size
+            std::size_t size;
+
+            // Number sign
+            bool sign;
+
+            // Whether the file is opened for writing
+            bool writable;
+
+
+            // Constructors
+
+            // Copy constructor, not allowed
+            mapped(const bnl::mapped &n);
+
+
+            // Methods
+
+            // Numeric data array
+            inline bnl::ulint *data() const {
+                return map + 1;
+            }
+
+            // Resize the file and the mapping to the given size in data blocks
+            void remap(const std::size_t &blocks);
+
+            // Remove the leading zero blocks and write the header
+            void shrink();
+
+            // Check whether the file is opened for writing
+            void check(const char *const operation) const;
+
+            // Compare the magnitudes and returns -1 if |this| < |n|, 0 if |this| == |n|, and 1 if |this| > |n|
+            int cmpabs(const bnl::ulint *const n_data, const std::size_t &n_size) const;
+
+            // Compare and returns -1 if this < n, 0 if this == n, and 1 if this > n
+            int cmp(const bnl::ulint *const n_data, const std::size_t &n_size, const bool &n_sign) const;
+
+            // Add a signed number in place
+            void add(const bnl::ulint *const n_data, const std::size_t &n_size, const bool &n_sign);
+
+
+            // Assignment operators
+
+            // Direct assignation, not allowed
+            bnl::mapped &operator = (const bnl::mapped &n);
+
+
+        public:
+            // Constructors
+
+            // Open an existing file
+            mapped(const std::string &path, const bool &writable = false);
+
+            // Create or truncate a file with the given number
+            mapped(const std::string &path, const bnl::integer &n);
+
+
+            // Destructor
+            ~mapped();
+
+
+            // Methods
+
+            // Numeric data array size
+            inline std::size_t blocks() const {
+                return size;
+            }
+
+            // Returns whether the value is negative
+            inline bool isneg() const {
+                return sign;
+            }
+
+            // The number copied to the heap
+            const bnl::integer load() const;
+
+            // The number viewed in place, valid while the file isn't modified
+            const bnl::integer_view view() const;
+
+            // Flush the changes to the file
+            void sync() const;
+
+            // Compare and returns -1 if this < n, 0 if this == n, and 1 if this > n
+            int compare(const bnl::integer &n) const;
+            int compare(const bnl::mapped &n) const;
+
+
+            // Assignment operators
+
+            // Assignation by addition
+            bnl::mapped &operator += (const bnl::integer &n);
+            bnl::mapped &operator += (const bnl::mapped &n);
+
+            // Assignation by subtraction
+            bnl::mapped &operator -= (const bnl::integer &n);
+            bnl::mapped &operator -= (const bnl::mapped &n);
+
+            // Assignation by left shift
+            bnl::mapped &operator <<= (const bnl::ulint &bits);
+
+            // Assignation by right shift, rounding toward negative infinity
+            bnl::mapped &operator >>= (const bnl::ulint &bits);
+    };
+}
+
+#endif // __BNL_MAPPED_HPP_
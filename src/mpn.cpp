@@ -0,0 +1,836 @@
+#include "mpn.hpp"
+#include "integer.hpp"   // bnl::integer
+#include "allocator.hpp" // bnl::scratch
+#include "parallel.hpp"  // bnl::task_t, bnl::parallel, bnl::is_parallel, bnl::workers
+#include "tuning.hpp"    // bnl::thresholds, bnl::thresholds_t
+#include "stats.hpp"     // BNL_STAT
+
+#include <algorithm> // std::max
+#include <vector>    // std::vector
+
+
+// Sizes
+
+// Maximum size in data blocks of the products computed with the number
+// theoretic transform, limited by the primes
+static const std::size_t ntt_max_size = static_cast<std::size_t>(1) << 23;
+
+
+// Number theoretic transform
+
+// Prime fields of the transforms p = c 2^k + 1, with their primitive roots.
+// Each coefficient of a product is lower than 2^23 (2^32)^2, less than the
+// product of the three primes, so it is recovered with the CRT
+static const bnl::ulint ntt_p1 = 2013265921; // 15 2^27 + 1
+static const bnl::ulint ntt_p2 = 469762049;  // 7 2^26 + 1
+static const bnl::ulint ntt_p3 = 998244353;  // 119 2^23 + 1
+static const bnl::ulint ntt_g1 = 31;
+static const bnl::ulint ntt_g2 = 3;
+static const bnl::ulint ntt_g3 = 3;
+
+// Power of a number modulo the prime P
+template <bnl::ulint P>
+static bnl::ulint ntt_pow(bnl::ulint a, bnl::ulint e) {
+    bnl::ulint ans = 1;
+    for (; e; e >>= 1, a = a * a % P)
+        if (e & 1)
+            ans = ans * a % P;
+
+    return ans;
+}
+
+// Run the tasks in the workers, or in the calling thread if not parallel
+static void execute(const bnl::task_t *const tasks, const std::size_t &count, const bool &parallel) {
+    if (parallel)
+        bnl::parallel(tasks, count);
+    else
+        for (std::size_t i = 0; i < count; i++)
+            tasks[i].run(tasks[i].arg);
+}
+
+// Minimum values of each part of a transform split between the workers
+static const std::size_t ntt_min_part = 4096;
+
+// Butterflies of the stages of lengths first to last of the values [a, a +
+// size), each stage restricted to the part of its half length. The roots are
+// the powers of the root of unity of the whole transform of n values
+template <bnl::ulint P>
+struct ntt_butterflies_t {
+    // Values and their count
+    bnl::ulint *a;
+    std::size_t size;
+
+    // Powers of the root of unity and the transform length
+    const bnl::ulint *roots;
+    std::size_t n;
+
+    // Lengths of the first and last stages
+    std::size_t first;
+    std::size_t last;
+
+    // Part of each stage and the number of parts
+    std::size_t part;
+    std::size_t parts;
+
+    // Run the butterflies
+    static void run(void *const arg) {
+        const ntt_butterflies_t &args = *static_cast<const ntt_butterflies_t *>(arg);
+
+        for (std::size_t len = args.first; len <= args.last; len <<= 1) {
+            const std::size_t step = args.n / len;
+            const std::size_t mid = len >> 1;
+            const std::size_t begin = mid * args.part / args.parts;
+            const std::size_t end = mid * (args.part + 1) / args.parts;
+
+            for (std::size_t i = 0; i < args.size; i += len) {
+                bnl::ulint *const x = args.a + i;
+                bnl::ulint *const y = x + mid;
+
+                for (std::size_t j = begin, k = begin * step; j < end; j++, k += step) {
+                    const bnl::ulint u = x[j];
+                    const bnl::ulint v = y[j] * args.roots[k] % P;
+                    x[j] = u + v < P ? u + v : u + v - P;
+                    y[j] = u < v ? u + P - v : u - v;
+                }
+            }
+        }
+    }
+};
+
+// In place transform of n = 2^k values modulo the prime P with primitive root
+// G, the inverse transform is not scaled. The butterflies are split in the
+// given number of parts, a power of two, run by the workers
+template <bnl::ulint P, bnl::ulint G>
+static void ntt(bnl::ulint *const a, const std::size_t &n, const bool &inverse, const std::size_t &parts) {
+    // Bit reversal permutation
+    for (std::size_t i = 1, j = 0; i < n; i++) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+
+        j ^= bit;
+        if (i < j) {
+            const bnl::ulint tmp = a[i];
+            a[i] = a[j];
+            a[j] = tmp;
+        }
+    }
+
+    // Powers of the n-th root of unity, shared by all the stages
+    const std::size_t half = n >> 1;
+    const bnl::scratch roots_mem(half);
+    bnl::ulint *const roots = roots_mem.data();
+    const bnl::ulint w = ntt_pow<P>(G, (P - 1) / n);
+    roots[0] = 1;
+    for (std::size_t i = 1; i < half; i++)
+        roots[i] = roots[i - 1] * w % P;
+
+    // Butterflies of each stage
+    if (parts < 2) {
+        ntt_butterflies_t<P> args = {a, n, roots, n, 2, n, 0, 1};
+        ntt_butterflies_t<P>::run(&args);
+    }
+    else {
+        std::vector<ntt_butterflies_t<P> > args(parts);
+        std::vector<bnl::task_t> tasks(parts);
+        const std::size_t size = n / parts;
+
+        // The first stages are independent on each part of the values
+        for (std::size_t i = 0; i < parts; i++) {
+            const ntt_butterflies_t<P> part = {a + i * size, size, roots, n, 2, size, 0, 1};
+            const bnl::task_t task = {ntt_butterflies_t<P>::run, &args[i]};
+            args[i] = part;
+            tasks[i] = task;
+        }
+
+        bnl::parallel(&tasks[0], parts);
+
+        // Each one of the last stages is split in parts of its half length
+        for (std::size_t len = size << 1; len <= n; len <<= 1) {
+            for (std::size_t i = 0; i < parts; i++) {
+                const ntt_butterflies_t<P> part = {a, n, roots, n, len, len, i, parts};
+                args[i] = part;
+            }
+
+            bnl::parallel(&tasks[0], parts);
+        }
+    }
+
+    // The inverse transform is the transform with the reversed outputs
+    if (inverse)
+        for (std::size_t i = 1, j = n - 1; i < j; i++, j--) {
+            const bnl::ulint tmp = a[i];
+            a[i] = a[j];
+            a[j] = tmp;
+        }
+}
+
+// Forward transform of the operand a of an data blocks modulo the prime P,
+// padded with zeros to n values
+template <bnl::ulint P, bnl::ulint G>
+struct ntt_forward_t {
+    // Transform values
+    bnl::ulint *fa;
+
+    // Operand
+    const bnl::ulint *a;
+    std::size_t an;
+
+    // Transform length and parts of each stage
+    std::size_t n;
+    std::size_t parts;
+
+    // Run the transform
+    static void run(void *const arg) {
+        const ntt_forward_t &args = *static_cast<const ntt_forward_t *>(arg);
+
+        for (std::size_t i = 0; i < args.n; i++)
+            args.fa[i] = i < args.an ? args.a[i] % P : 0;
+
+        ntt<P, G>(args.fa, args.n, false, args.parts);
+    }
+};
+
+// Cyclic convolution of a and b modulo the prime P, of n = 2^k values with
+// both operands padded with zeros. The answer is stored in fc, scaled by 1 / n
+template <bnl::ulint P, bnl::ulint G>
+struct ntt_convolution_t {
+    // Convolution values
+    bnl::ulint *fc;
+
+    // Operands
+    const bnl::ulint *a;
+    std::size_t an;
+    const bnl::ulint *b;
+    std::size_t bn;
+
+    // Transform length and parts of each stage
+    std::size_t n;
+    std::size_t parts;
+
+    // Run the convolution
+    static void run(void *const arg) {
+        const ntt_convolution_t &args = *static_cast<const ntt_convolution_t *>(arg);
+        const std::size_t &n = args.n;
+        bnl::ulint *const fa = args.fc;
+
+        // Transforms of both operands, or a single transform to square
+        const bool square = args.a == args.b;
+        const bnl::scratch fb_mem(square ? 1 : n);
+        bnl::ulint *const fb = square ? fa : fb_mem.data();
+
+        ntt_forward_t<P, G> forward[2] = {
+            {fa, args.a, args.an, n, args.parts},
+            {fb, args.b, args.bn, n, args.parts}
+        };
+        const bnl::task_t tasks[2] = {
+            {ntt_forward_t<P, G>::run, &forward[0]},
+            {ntt_forward_t<P, G>::run, &forward[1]}
+        };
+
+        execute(tasks, square ? 1 : 2, args.parts > 1);
+
+        // Pointwise product scaled by 1 / n, and inverse transform
+        const bnl::ulint scale = ntt_pow<P>(n % P, P - 2);
+        for (std::size_t i = 0; i < n; i++)
+            fa[i] = fa[i] * fb[i] % P * scale % P;
+
+        ntt<P, G>(fa, n, true, args.parts);
+    }
+};
+
+// Product r = a * b of an + bn data blocks with the number theoretic
+// transform over three primes, a square if both operands are the same
+static void mul_ntt(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn) {
+    BNL_STAT(bnl::STAT_MUL_NTT, std::max(an, bn));
+
+    // Transforms length
+    const std::size_t size = an + bn;
+    std::size_t n = 1;
+    while (n < size)
+        n <<= 1;
+
+    // Parts of each transform, a power of two up to the workers
+    std::size_t parts = 1;
+    if (bnl::is_parallel(bn))
+        while ((parts << 1 <= bnl::workers()) && (n / (parts << 1) >= ntt_min_part))
+            parts <<= 1;
+
+    // Convolutions modulo each prime, run by the workers
+    const bnl::scratch mem(3 * n);
+    bnl::ulint *const c1 = mem.data();
+    bnl::ulint *const c2 = c1 + n;
+    bnl::ulint *const c3 = c2 + n;
+
+    ntt_convolution_t<ntt_p1, ntt_g1> conv1 = {c1, a, an, b, bn, n, parts};
+    ntt_convolution_t<ntt_p2, ntt_g2> conv2 = {c2, a, an, b, bn, n, parts};
+    ntt_convolution_t<ntt_p3, ntt_g3> conv3 = {c3, a, an, b, bn, n, parts};
+    const bnl::task_t tasks[3] = {
+        {ntt_convolution_t<ntt_p1, ntt_g1>::run, &conv1},
+        {ntt_convolution_t<ntt_p2, ntt_g2>::run, &conv2},
+        {ntt_convolution_t<ntt_p3, ntt_g3>::run, &conv3}
+    };
+
+    execute(tasks, 3, parts > 1);
+
+    // Garner's constants, x = r1 + p1 t2 + p1 p2 t3
+    const bnl::ulint p1_inv = ntt_pow<ntt_p2>(ntt_p1 % ntt_p2, ntt_p2 - 2);
+    const bnl::ulint p12_inv = ntt_pow<ntt_p3>(ntt_p1 * ntt_p2 % ntt_p3, ntt_p3 - 2);
+    const bnl::ulint p1_mod = ntt_p1 % ntt_p3;
+    const bnl::ulint p12 = ntt_p1 * ntt_p2;
+    const bnl::ulint p12_low = p12 & bnl::integer::base_mask;
+    const bnl::ulint p12_high = p12 >> 32;
+
+    // Recover each coefficient and propagate the carry of two data blocks
+    bnl::ulint carry_low = 0, carry_high = 0;
+    for (std::size_t i = 0; i < size; i++) {
+        const bnl::ulint r1 = c1[i];
+        const bnl::ulint t2 = (c2[i] + ntt_p2 - r1 % ntt_p2) % ntt_p2 * p1_inv % ntt_p2;
+        const bnl::ulint t3 = (c3[i] + 2 * ntt_p3 - r1 % ntt_p3 - t2 * p1_mod % ntt_p3) % ntt_p3 * p12_inv % ntt_p3;
+
+        // Coefficient in three data blocks, plus the carry
+        const bnl::ulint v = r1 + ntt_p1 * t2;
+        const bnl::ulint low = p12_low * t3;
+        const bnl::ulint high = p12_high * t3;
+
+        const bnl::ulint d0 = (v & bnl::integer::base_mask) + (low & bnl::integer::base_mask) + carry_low;
+        const bnl::ulint d1 = (v >> 32) + (low >> 32) + (high & bnl::integer::base_mask) + carry_high + (d0 >> 32);
+
+        r[i] = d0 & bnl::integer::base_mask;
+        carry_low = d1 & bnl::integer::base_mask;
+        carry_high = (high >> 32) + (d1 >> 32);
+    }
+}
+
+
+
+
+// Schoolbook and Karatsuba's products
+
+// Absolute difference r = |a - b| of n data blocks, where b has only m <= n
+// blocks, returns whether a < b
+static bool diff(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n, const std::size_t &m) {
+    // Compare from the most significative block, b extended with zeros
+    bool less = false;
+    for (std::size_t i = n - 1; i < n; i--) {
+        const bnl::ulint block = i < m ? b[i] : 0;
+        if (a[i] != block) {
+            less = a[i] < block;
+            break;
+        }
+    }
+
+    // Subtract the smaller from the larger
+    bnl::ulint borrow = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint x = i < m ? b[i] : 0;
+        const bnl::ulint d = less ? x - a[i] - borrow : a[i] - x - borrow;
+        r[i] = d & bnl::integer::base_mask;
+        borrow = d >> 63;
+    }
+
+    return less;
+}
+
+// Schoolbook product r = a * b of an + bn data blocks
+static void mul_basecase(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn) {
+    BNL_STAT(bnl::STAT_MUL_BASECASE, std::max(an, bn));
+
+    // First partial product, then accumulate each one in place skipping the
+    // zero blocks
+    r[an] = bnl::mpn::mul_1(r, a, an, b[0]);
+    for (std::size_t i = 1; i < bn; i++)
+        r[an + i] = b[i] ? bnl::mpn::addmul_1(r + i, a, an, b[i]) : 0;
+}
+
+// Schoolbook square r = a^2 of 2n data blocks
+static void sqr_basecase(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n) {
+    BNL_STAT(bnl::STAT_SQR_BASECASE, n);
+
+    for (std::size_t i = 0; i < n << 1; i++)
+        r[i] = 0;
+
+    // Cross products, each one computed once, accumulating the blocks at the
+    // left of each non-zero block
+    for (std::size_t i = 0; i + 1 < n; i++)
+        if (a[i])
+            r[i + n] = bnl::mpn::addmul_1(r + (i << 1) + 1, a + i + 1, n - i - 1, a[i]);
+
+    // Double the cross products and add the square of each block
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0, j = 0; i < n; i++, j += 2) {
+        const bnl::ulint prod = a[i] * a[i];
+
+        const bnl::ulint low = (r[j] << 1) + (prod & bnl::integer::base_mask) + carry;
+        r[j] = low & bnl::integer::base_mask;
+        carry = low >> 32;
+
+        const bnl::ulint high = (r[j + 1] << 1) + (prod >> 32) + carry;
+        r[j + 1] = high & bnl::integer::base_mask;
+        carry = high >> 32;
+    }
+}
+
+// Add the middle Karatsuba's term z0 + z2 -/+ t, of 2 lo data blocks, to the
+// product r of 2n data blocks at the position lo
+static void karatsuba_middle(bnl::ulint *const r, const bnl::ulint *const t, bnl::ulint *const m, const std::size_t &n, const std::size_t &lo, const bool &add) {
+    const std::size_t hi = n - lo;
+
+    // z0 + z2, with z0 at the lowest 2 lo blocks and z2 at the highest 2 hi blocks
+    for (std::size_t i = 0; i < lo << 1; i++)
+        m[i] = r[i];
+
+    m[lo << 1] = bnl::mpn::add_1(m + (hi << 1), m + (hi << 1), (lo - hi) << 1, bnl::mpn::add_n(m, m, r + (lo << 1), hi << 1));
+
+    // Add or subtract the product of the halves differences
+    if (add)
+        m[lo << 1] += bnl::mpn::add_n(m, m, t, lo << 1);
+    else
+        m[lo << 1] -= bnl::mpn::sub_n(m, m, t, lo << 1);
+
+    // Accumulate at the position lo
+    const std::size_t size = (lo << 1) + 1;
+    bnl::mpn::add_1(r + lo + size, r + lo + size, (n << 1) - lo - size, bnl::mpn::add_n(r + lo, r + lo, m, size));
+}
+
+static void mul_karatsuba(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n, bnl::ulint *const scratch);
+static void sqr_karatsuba(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, bnl::ulint *const scratch);
+
+// Karatsuba's product or square of a sub-product, run by a worker with its
+// own scratch memory
+struct karatsuba_t {
+    // Product of 2n data blocks
+    bnl::ulint *r;
+
+    // Operands of n data blocks, the same ones to square
+    const bnl::ulint *a;
+    const bnl::ulint *b;
+    std::size_t n;
+
+    // Run the product
+    static void run(void *const arg) {
+        const karatsuba_t &args = *static_cast<const karatsuba_t *>(arg);
+        const bnl::scratch mem(4 * args.n + 64);
+
+        if (args.a == args.b)
+            sqr_karatsuba(args.r, args.a, args.n, mem.data());
+        else
+            mul_karatsuba(args.r, args.a, args.b, args.n, mem.data());
+    }
+};
+
+// Karatsuba's product r = a * b of n data blocks each, the scratch memory has
+// at least 4n + 64 blocks for all the recursion levels
+static void mul_karatsuba(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n, bnl::ulint *const scratch) {
+    BNL_STAT(bnl::STAT_MUL_KARATSUBA, n);
+
+    const bnl::thresholds_t &sizes = bnl::thresholds();
+    if (n < sizes.karatsuba_mul) {
+        mul_basecase(r, a, n, b, n);
+        return;
+    }
+
+    if ((n >= sizes.ntt_mul) && (n << 1 <= ntt_max_size)) {
+        mul_ntt(r, a, n, b, n);
+        return;
+    }
+
+    // Low and high halves sizes, and scratch memory
+    const std::size_t hi = n >> 1;
+    const std::size_t lo = n - hi;
+    bnl::ulint *const da = scratch;
+    bnl::ulint *const db = da + lo;
+    bnl::ulint *const t = db + lo;
+    bnl::ulint *const next = t + (lo << 1);
+
+    // Differences of the halves |a0 - a1| and |b0 - b1|
+    const bool add = diff(da, a, a + lo, lo, hi) != diff(db, b, b + lo, lo, hi);
+
+    // z0 = a0 b0, z2 = a1 b1 and t = |a0 - a1| |b0 - b1|, run by the workers
+    // if the operands are large enough
+    if (bnl::is_parallel(n)) {
+        karatsuba_t args[3] = {
+            {r, a, b, lo},
+            {r + (lo << 1), a + lo, b + lo, hi},
+            {t, da, db, lo}
+        };
+        const bnl::task_t tasks[3] = {
+            {karatsuba_t::run, &args[0]},
+            {karatsuba_t::run, &args[1]},
+            {karatsuba_t::run, &args[2]}
+        };
+
+        bnl::parallel(tasks, 3);
+    }
+    else {
+        mul_karatsuba(r, a, b, lo, next);
+        mul_karatsuba(r + (lo << 1), a + lo, b + lo, hi, next);
+        mul_karatsuba(t, da, db, lo, next);
+    }
+
+    // a0 b1 + a1 b0 = z0 + z2 - (a0 - a1)(b0 - b1)
+    karatsuba_middle(r, t, next, n, lo, add);
+}
+
+// Karatsuba's square r = a^2 of n data blocks, the scratch memory has at
+// least 4n + 64 blocks for all the recursion levels
+static void sqr_karatsuba(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, bnl::ulint *const scratch) {
+    BNL_STAT(bnl::STAT_SQR_KARATSUBA, n);
+
+    const bnl::thresholds_t &sizes = bnl::thresholds();
+    if (n < sizes.karatsuba_sqr) {
+        sqr_basecase(r, a, n);
+        return;
+    }
+
+    if ((n >= sizes.ntt_sqr) && (n << 1 <= ntt_max_size)) {
+        mul_ntt(r, a, n, a, n);
+        return;
+    }
+
+    // Low and high halves sizes, and scratch memory
+    const std::size_t hi = n >> 1;
+    const std::size_t lo = n - hi;
+    bnl::ulint *const da = scratch;
+    bnl::ulint *const t = da + lo;
+    bnl::ulint *const next = t + (lo << 1);
+
+    // Difference of the halves |a0 - a1|
+    diff(da, a, a + lo, lo, hi);
+
+    // z0 = a0^2, z2 = a1^2 and t = (a0 - a1)^2, run by the workers if the
+    // operand is large enough
+    if (bnl::is_parallel(n)) {
+        karatsuba_t args[3] = {
+            {r, a, a, lo},
+            {r + (lo << 1), a + lo, a + lo, hi},
+            {t, da, da, lo}
+        };
+        const bnl::task_t tasks[3] = {
+            {karatsuba_t::run, &args[0]},
+            {karatsuba_t::run, &args[1]},
+            {karatsuba_t::run, &args[2]}
+        };
+
+        bnl::parallel(tasks, 3);
+    }
+    else {
+        sqr_karatsuba(r, a, lo, next);
+        sqr_karatsuba(r + (lo << 1), a + lo, hi, next);
+        sqr_karatsuba(t, da, lo, next);
+    }
+
+    // 2 a0 a1 = z0 + z2 - (a0 - a1)^2
+    karatsuba_middle(r, t, next, n, lo, false);
+}
+
+// Product of a slice of the larger operand, run by a worker
+struct slice_t {
+    // Product of an + bn data blocks
+    bnl::ulint *r;
+
+    // Slice of the larger operand
+    const bnl::ulint *a;
+    std::size_t an;
+
+    // Other operand
+    const bnl::ulint *b;
+    std::size_t bn;
+
+    // Run the product
+    static void run(void *const arg) {
+        const slice_t &args = *static_cast<const slice_t *>(arg);
+
+        if (args.an >= args.bn)
+            bnl::mpn::mul(args.r, args.a, args.an, args.b, args.bn);
+        else
+            bnl::mpn::mul(args.r, args.b, args.bn, args.a, args.an);
+    }
+};
+
+// Product r = a * b of an + bn data blocks with an >= bn
+void bnl::mpn::mul(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn) {
+    if (bn < bnl::thresholds().karatsuba_mul) {
+        mul_basecase(r, a, an, b, bn);
+        return;
+    }
+
+    // Balanced operands
+    if (an == bn) {
+        const bnl::scratch mem(4 * bn + 64);
+        mul_karatsuba(r, a, b, bn, mem.data());
+        return;
+    }
+
+    // Multiply each slice of bn blocks of a and accumulate
+    for (std::size_t i = 0; i < an + bn; i++)
+        r[i] = 0;
+
+    // Products of a batch of slices run by the workers, each one in its own
+    // part of the scratch memory, accumulated by the calling thread
+    if (bnl::is_parallel(bn)) {
+        const std::size_t batch = bnl::workers();
+        const bnl::scratch products(batch * (bn << 1));
+        std::vector<slice_t> args(batch);
+        std::vector<bnl::task_t> tasks(batch);
+
+        for (std::size_t i = 0; i < an; i += batch * bn) {
+            std::size_t count = 0;
+            for (std::size_t j = i; (j < an) && (count < batch); j += bn, count++) {
+                const slice_t slice = {products.data() + count * (bn << 1), a + j, an - j < bn ? an - j : bn, b, bn};
+                const bnl::task_t task = {slice_t::run, &args[count]};
+                args[count] = slice;
+                tasks[count] = task;
+            }
+
+            bnl::parallel(&tasks[0], count);
+
+            for (std::size_t j = 0; j < count; j++) {
+                const std::size_t size = args[j].an + bn;
+                bnl::ulint *const row = r + i + j * bn;
+                bnl::mpn::add_1(row + size, row + size, an + bn - (i + j * bn) - size, bnl::mpn::add_n(row, row, args[j].r, size));
+            }
+        }
+
+        return;
+    }
+
+    // Scratch memory for the recursion and the partial products
+    const bnl::scratch mem(6 * bn + 64);
+    bnl::ulint *const scratch = mem.data();
+    bnl::ulint *const tmp = scratch + 4 * bn + 64;
+
+    for (std::size_t i = 0; i < an; i += bn) {
+        const std::size_t slice = an - i < bn ? an - i : bn;
+
+        if (slice == bn)
+            mul_karatsuba(tmp, a + i, b, bn, scratch);
+        else
+            bnl::mpn::mul(tmp, b, bn, a + i, slice);
+
+        const std::size_t size = slice + bn;
+        bnl::mpn::add_1(r + i + size, r + i + size, an + bn - i - size, bnl::mpn::add_n(r + i, r + i, tmp, size));
+    }
+}
+
+// Square r = a^2 of 2n data blocks
+void bnl::mpn::sqr(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n) {
+    if (n < bnl::thresholds().karatsuba_sqr) {
+        sqr_basecase(r, a, n);
+        return;
+    }
+
+    // Scratch memory for the recursion
+    const bnl::scratch mem(4 * n + 64);
+    sqr_karatsuba(r, a, n, mem.data());
+}
+
+
+// Comparison
+
+// Compare n data blocks and returns -1 if a < b, 0 if a == b, and 1 if a > b
+int bnl::mpn::cmp(const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n) {
+    // Compare each data block from the most significative
+    for (std::size_t i = n - 1; i < n; i--)
+        if (a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+
+    return 0;
+}
+
+// Size of the n data blocks without the leading zero blocks
+std::size_t bnl::mpn::normalize(const bnl::ulint *const a, const std::size_t &n) {
+    std::size_t size = n;
+    while (size && !a[size - 1])
+        size--;
+
+    return size;
+}
+
+// Trailing zero bits of n data blocks, all the bits if all of them are zero
+std::size_t bnl::mpn::ctz(const bnl::ulint *const a, const std::size_t &n) {
+    // Skip the zero blocks
+    std::size_t i = 0;
+    while ((i < n) && !a[i])
+        i++;
+
+    if (i == n)
+        return n << 5;
+
+    // Count the zero bits of the first non-zero block
+    std::size_t bits = i << 5;
+    for (bnl::ulint block = a[i]; !(block & 1); block >>= 1)
+        bits++;
+
+    return bits;
+}
+
+
+// Addition and subtraction
+
+// Addition r = a + b of n data blocks, returns the carry
+bnl::ulint bnl::mpn::add_n(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n) {
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint sum = a[i] + b[i] + carry;
+        r[i] = sum & bnl::integer::base_mask;
+        carry = sum >> 32;
+    }
+
+    return carry;
+}
+
+// Addition r = a + b of a block to n data blocks, returns the carry
+bnl::ulint bnl::mpn::add_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // Propagate the carry while there is any
+    bnl::ulint carry = b;
+    std::size_t i = 0;
+    for (; carry && (i < n); i++) {
+        const bnl::ulint sum = a[i] + carry;
+        r[i] = sum & bnl::integer::base_mask;
+        carry = sum >> 32;
+    }
+
+    // Copy the remaining blocks, if not in place
+    if (r != a)
+        for (; i < n; i++)
+            r[i] = a[i];
+
+    return carry;
+}
+
+// Addition r = a + b of an data blocks with bn <= an, returns the carry
+bnl::ulint bnl::mpn::add(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn) {
+    return bnl::mpn::add_1(r + bn, a + bn, an - bn, bnl::mpn::add_n(r, a, b, bn));
+}
+
+// Subtraction r = a - b of n data blocks, returns the borrow
+bnl::ulint bnl::mpn::sub_n(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n) {
+    bnl::ulint borrow = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint diff = a[i] - b[i] - borrow;
+        r[i] = diff & bnl::integer::base_mask;
+        borrow = diff >> 63;
+    }
+
+    return borrow;
+}
+
+// Subtraction r = a - b of a block from n data blocks, returns the borrow
+bnl::ulint bnl::mpn::sub_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // Propagate the borrow while there is any
+    bnl::ulint borrow = b;
+    std::size_t i = 0;
+    for (; borrow && (i < n); i++) {
+        const bnl::ulint diff = a[i] - borrow;
+        r[i] = diff & bnl::integer::base_mask;
+        borrow = diff >> 63;
+    }
+
+    // Copy the remaining blocks, if not in place
+    if (r != a)
+        for (; i < n; i++)
+            r[i] = a[i];
+
+    return borrow;
+}
+
+// Subtraction r = a - b of an data blocks with bn <= an, returns the borrow
+bnl::ulint bnl::mpn::sub(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn) {
+    return bnl::mpn::sub_1(r + bn, a + bn, an - bn, bnl::mpn::sub_n(r, a, b, bn));
+}
+
+
+// Products by a data block
+
+// Product r = a * b of n data blocks, returns the highest block
+bnl::ulint bnl::mpn::mul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // The product plus the carry never exceeds 64 bits
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint prod = a[i] * b + carry;
+        r[i] = prod & bnl::integer::base_mask;
+        carry = prod >> 32;
+    }
+
+    return carry;
+}
+
+// Accumulated product r = r + a * b of n data blocks, returns the carry block
+bnl::ulint bnl::mpn::addmul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // The product plus two blocks never exceeds 64 bits
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint prod = a[i] * b + r[i] + carry;
+        r[i] = prod & bnl::integer::base_mask;
+        carry = prod >> 32;
+    }
+
+    return carry;
+}
+
+// Subtracted product r = r - a * b of n data blocks, returns the block to
+// subtract from the next one
+bnl::ulint bnl::mpn::submul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // The carry holds the high product and the borrow of the previous block
+    bnl::ulint carry = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const bnl::ulint prod = a[i] * b + carry;
+        const bnl::ulint diff = r[i] - (prod & bnl::integer::base_mask);
+        r[i] = diff & bnl::integer::base_mask;
+        carry = (prod >> 32) + (diff >> 63);
+    }
+
+    return carry;
+}
+
+// Quotient q = a / b of n data blocks by a non-zero block, returns the
+// remainder
+bnl::ulint bnl::mpn::divrem_1(bnl::ulint *const q, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // Divide each block from the most significative
+    bnl::ulint rem = 0;
+    for (std::size_t i = n - 1; i < n; i--) {
+        const bnl::ulint num = (rem << 32) | a[i];
+        q[i] = num / b;
+        rem = num % b;
+    }
+
+    return rem;
+}
+
+// Remainder a % b of n data blocks by a non-zero block
+bnl::ulint bnl::mpn::mod_1(const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b) {
+    // Divide each block from the most significative, keeping the remainder
+    bnl::ulint rem = 0;
+    for (std::size_t i = n - 1; i < n; i--)
+        rem = ((rem << 32) | a[i]) % b;
+
+    return rem;
+}
+
+
+// Shifts
+
+// Left shift r = a << bits of n data blocks, returns the bits shifted out
+bnl::ulint bnl::mpn::lshift(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const std::size_t &bits) {
+    // From the most significative block, so it can be done in place
+    const std::size_t shift_r = 32 - bits;
+    const bnl::ulint ans = a[n - 1] >> shift_r;
+    for (std::size_t i = n - 1; i; i--)
+        r[i] = ((a[i] << bits) & bnl::integer::base_mask) | (a[i - 1] >> shift_r);
+    r[0] = (a[0] << bits) & bnl::integer::base_mask;
+
+    return ans;
+}
+
+// Right shift r = a >> bits of n data blocks, returns the bits shifted out
+bnl::ulint bnl::mpn::rshift(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const std::size_t &bits) {
+    // From the least significative block, so it can be done in place
+    const std::size_t shift_l = 32 - bits;
+    const bnl::ulint ans = a[0] & ((static_cast<bnl::ulint>(1) << bits) - 1);
+    for (std::size_t i = 0; i + 1 < n; i++)
+        r[i] = (a[i] >> bits) | ((a[i + 1] << shift_l) & bnl::integer::base_mask);
+    r[n - 1] = a[n - 1] >> bits;
+
+    return ans;
+}
@@ -0,0 +1,105 @@
+#ifndef __BNL_MPN_HPP_
+#define __BNL_MPN_HPP_
+
+#include "bnl.hpp" // bnl::ulint
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Low level kernels over spans of data blocks with the bnl::integer
+    // layout, 32 bits in each bnl::ulint from the least significative. They
+    // check nothing and never allocate from the allocator of the numbers: the
+    // sizes are the callers' business, every span has at least one block
+    // unless stated otherwise, and the answer may be one of the operands only
+    // where it's stated. The product and the square take their temporary
+    // memory from the scratch stack of the calling thread, and may run their
+    // sub-products in the workers
+    namespace mpn {
+        // Comparison
+
+        // Compare n data blocks and returns -1 if a < b, 0 if a == b, and 1 if
+        // a > b
+        int cmp(const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n);
+
+        // Size of the n data blocks without the leading zero blocks, zero if
+        // all of them are zero
+        std::size_t normalize(const bnl::ulint *const a, const std::size_t &n);
+
+        // Trailing zero bits of n data blocks, all the bits if all of them are
+        // zero
+        std::size_t ctz(const bnl::ulint *const a, const std::size_t &n);
+
+
+        // Addition and subtraction, the answer may be any of the operands
+
+        // Addition r = a + b of n data blocks, returns the carry
+        bnl::ulint add_n(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n);
+
+        // Addition r = a + b of a block lower than the base to n data blocks,
+        // n may be zero, returns the carry
+        bnl::ulint add_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Addition r = a + b of an data blocks with bn <= an, returns the carry
+        bnl::ulint add(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn);
+
+        // Subtraction r = a - b of n data blocks, returns the borrow
+        bnl::ulint sub_n(bnl::ulint *const r, const bnl::ulint *const a, const bnl::ulint *const b, const std::size_t &n);
+
+        // Subtraction r = a - b of a block lower than the base from n data
+        // blocks, n may be zero, returns the borrow
+        bnl::ulint sub_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Subtraction r = a - b of an data blocks with bn <= an, returns the
+        // borrow
+        bnl::ulint sub(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn);
+
+
+        // Products by a data block lower than the base, the answer may be the
+        // operand
+
+        // Product r = a * b of n data blocks, returns the highest block
+        bnl::ulint mul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Accumulated product r = r + a * b of n data blocks, returns the carry
+        // block
+        bnl::ulint addmul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Subtracted product r = r - a * b of n data blocks, returns the block
+        // to subtract from the next one, at most the base
+        bnl::ulint submul_1(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Quotient q = a / b of n data blocks by a non-zero block, returns the
+        // remainder
+        bnl::ulint divrem_1(bnl::ulint *const q, const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+        // Remainder a % b of n data blocks by a non-zero block
+        bnl::ulint mod_1(const bnl::ulint *const a, const std::size_t &n, const bnl::ulint &b);
+
+
+        // Shifts by less than 32 bits
+
+        // Left shift r = a << bits of n data blocks, returns the bits shifted
+        // out as the lowest bits of a block. The answer may start at or above
+        // the operand
+        bnl::ulint lshift(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const std::size_t &bits);
+
+        // Right shift r = a >> bits of n data blocks, returns the bits shifted
+        // out as the lowest bits of a block. The answer may start at or below
+        // the operand
+        bnl::ulint rshift(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n, const std::size_t &bits);
+
+
+        // Products, the answer can't overlap the operands
+
+        // Product r = a * b of an + bn data blocks with an >= bn, chosen
+        // between the schoolbook, Karatsuba's and the NTT products
+        void mul(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &an, const bnl::ulint *const b, const std::size_t &bn);
+
+        // Square r = a^2 of 2n data blocks
+        void sqr(bnl::ulint *const r, const bnl::ulint *const a, const std::size_t &n);
+    }
+}
+
+#endif // __BNL_MPN_HPP_
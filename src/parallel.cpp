@@ -0,0 +1,241 @@
+#include "parallel.hpp"
+
+#include <cstdlib> // std::malloc, std::free
+#include <new>     // std::bad_alloc
+#include <vector>  // std::vector
+
+#include <pthread.h> // pthread_t, pthread_create, pthread_join, pthread_mutex_t, pthread_cond_t
+
+
+// Sizes
+
+// Default minimum size in data blocks of the operands of a parallel product
+static const std::size_t default_threshold = 8192;
+
+
+// Worker pool
+
+// Tasks of a single bnl::parallel call
+struct group_t {
+    // Tasks not finished yet
+    std::size_t pending;
+
+    // Whether any task failed
+    bool failed;
+};
+
+// Queued task, stored by the bnl::parallel call that waits for it
+struct job_t {
+    // Task to run
+    bnl::task_t task;
+
+    // Group of the task
+    group_t *group;
+
+    // Next job of the queue
+    job_t *next;
+};
+
+// Pool state, all of it plain data so it is never destroyed while the workers
+// are waiting at the program exit
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+
+// Queue of the pending jobs
+static job_t *queue_head = NULL;
+static job_t *queue_tail = NULL;
+
+// Worker threads, started on the first parallel call
+static pthread_t *threads = NULL;
+static std::size_t started = 0;
+static bool stopping = false;
+
+// Configuration
+static std::size_t threads_count = 1;
+static std::size_t threshold = default_threshold;
+
+// Take the first job of the queue, with the pool locked
+static job_t *pop() {
+    job_t *const job = queue_head;
+    if (job) {
+        queue_head = job->next;
+        if (!queue_head)
+            queue_tail = NULL;
+    }
+
+    return job;
+}
+
+// Run a job and update its group, with the pool unlocked
+static void execute(job_t *const job) {
+    bool failed = false;
+    try {
+        job->task.run(job->task.arg);
+    }
+    catch (...) {
+        failed = true;
+    }
+
+    pthread_mutex_lock(&pool_mutex);
+    job->group->failed |= failed;
+    if (!--job->group->pending)
+        pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+// Worker thread main loop
+static void *worker(void *) {
+    pthread_mutex_lock(&pool_mutex);
+
+    for (;;) {
+        job_t *const job = pop();
+        if (job) {
+            pthread_mutex_unlock(&pool_mutex);
+            execute(job);
+            pthread_mutex_lock(&pool_mutex);
+        }
+        else if (stopping)
+            break;
+        else
+            pthread_cond_wait(&pool_cond, &pool_mutex);
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+    return NULL;
+}
+
+// Start the worker threads, with the pool locked
+static void start() {
+    const std::size_t count = threads_count - 1;
+    threads = static_cast<pthread_t *>(std::malloc(count * sizeof(pthread_t)));
+    if (!threads)
+        throw std::bad_alloc();
+
+    // Run sequentially with the threads that could be started
+    for (started = 0; started < count; started++)
+        if (pthread_create(threads + started, NULL, worker, NULL))
+            break;
+}
+
+// Stop and join the worker threads
+static void stop() {
+    pthread_mutex_lock(&pool_mutex);
+    stopping = true;
+    pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    for (std::size_t i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+
+    std::free(threads);
+    threads = NULL;
+    started = 0;
+    stopping = false;
+}
+
+
+// Workers configuration
+
+// Set the threads used by the large products, including the calling thread
+void bnl::set_workers(const std::size_t &n) {
+    if (threads)
+        stop();
+
+    threads_count = n ? n : 1;
+}
+
+// Threads used by the large products, including the calling thread
+std::size_t bnl::workers() {
+    return threads_count;
+}
+
+// Set the minimum size in data blocks of the operands of a parallel product
+void bnl::set_parallel_threshold(const std::size_t &blocks) {
+    threshold = blocks;
+}
+
+// Minimum size in data blocks of the operands of a parallel product
+std::size_t bnl::parallel_threshold() {
+    return threshold;
+}
+
+// Whether a product of operands of the given size is split between the workers
+bool bnl::is_parallel(const std::size_t &blocks) {
+    return (threads_count > 1) && (blocks >= threshold);
+}
+
+
+// Parallel execution
+
+// Run the tasks in the workers and the calling thread
+void bnl::parallel(const bnl::task_t *const tasks, const std::size_t &count) {
+    if (!count)
+        return;
+
+    // Sequential execution
+    if ((threads_count < 2) || (count == 1)) {
+        for (std::size_t i = 0; i < count; i++)
+            tasks[i].run(tasks[i].arg);
+
+        return;
+    }
+
+    // Queue all the tasks but the first one, run by the calling thread
+    group_t group = {count - 1, false};
+    std::vector<job_t> jobs(count - 1);
+
+    pthread_mutex_lock(&pool_mutex);
+    if (!threads) {
+        try {
+            start();
+        }
+        catch (...) {
+            pthread_mutex_unlock(&pool_mutex);
+            throw;
+        }
+    }
+
+    for (std::size_t i = 0; i < count - 1; i++) {
+        jobs[i].task = tasks[i + 1];
+        jobs[i].group = &group;
+        jobs[i].next = NULL;
+
+        if (queue_tail)
+            queue_tail->next = &jobs[i];
+        else
+            queue_head = &jobs[i];
+
+        queue_tail = &jobs[i];
+    }
+
+    pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    // The jobs are stored in this frame, so wait for them even on failure
+    bool failed = false;
+    try {
+        tasks[0].run(tasks[0].arg);
+    }
+    catch (...) {
+        failed = true;
+    }
+
+    // Run the pending jobs while waiting, of this group or any other
+    pthread_mutex_lock(&pool_mutex);
+    while (group.pending) {
+        job_t *const job = pop();
+        if (job) {
+            pthread_mutex_unlock(&pool_mutex);
+            execute(job);
+            pthread_mutex_lock(&pool_mutex);
+        }
+        else
+            pthread_cond_wait(&pool_cond, &pool_mutex);
+    }
+
+    failed |= group.failed;
+    pthread_mutex_unlock(&pool_mutex);
+
+    if (failed)
+        throw std::bad_alloc();
+}
@@ -0,0 +1,48 @@
+#ifndef __BNL_PARALLEL_HPP_
+#define __BNL_PARALLEL_HPP_
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Task run by the workers, the function is called with the argument
+    struct task_t {
+        // Task function
+        void (*run)(void *const arg);
+
+        // Task argument
+        void *arg;
+    };
+
+
+    // Workers configuration
+
+    // Set the threads used by the large products, including the calling
+    // thread. One runs everything in the calling thread, which is the default.
+    // It must not be called while a product is running
+    void set_workers(const std::size_t &n);
+
+    // Threads used by the large products, including the calling thread
+    std::size_t workers();
+
+    // Set the minimum size in data blocks of the operands of a product to
+    // split it between the workers
+    void set_parallel_threshold(const std::size_t &blocks);
+
+    // Minimum size in data blocks of the operands of a product to split it
+    // between the workers
+    std::size_t parallel_threshold();
+
+    // Whether a product of operands of the given size in data blocks is split
+    // between the workers
+    bool is_parallel(const std::size_t &blocks);
+
+
+    // Run the tasks in the workers and the calling thread, and return when all
+    // of them are done. Tasks can run more tasks, the waiting threads run the
+    // pending ones meanwhile. The tasks may only throw std::bad_alloc
+    void parallel(const bnl::task_t *const tasks, const std::size_t &count);
+}
+
+#endif // __BNL_PARALLEL_HPP_
@@ -0,0 +1,299 @@
+#include "prime.hpp"
+#include "barrett.hpp" // bnl::barrett
+#include "mpn.hpp"     // bnl::mpn
+#include "root.hpp"    // bnl::is_perfect_square
+
+#include <vector> // std::vector
+
+
+// Sizes
+
+// Small primes used by the trial division
+static const std::size_t trial_primes = 256;
+
+// Numbers checked on each sieve window of bnl::next_prime
+static const std::size_t sieve_window = 4096;
+
+
+// Small primes
+
+// Small primes lower than 2^16
+static const struct primes_t {
+    // Attributes
+
+    // Primes in ascending order
+    std::vector<bnl::ulint> list;
+
+
+    // Constructors
+
+    // Sieve of Eratosthenes
+    primes_t() {
+        std::vector<bool> composite(65536, false);
+
+        for (bnl::ulint i = 2; i < 65536; i++) {
+            if (composite[i])
+                continue;
+
+            list.push_back(i);
+            for (bnl::ulint j = i * i; j < 65536; j += i)
+                composite[j] = true;
+        }
+    }
+} primes;
+
+
+// Numeric data functions
+
+// Remainders of numeric data divided by the first small primes
+static void residues(const bnl::ulint *const data, const std::size_t &size, const std::size_t &count, std::vector<bnl::ulint> &ans) {
+    ans.resize(count);
+
+    for (std::size_t i = 0; i < count;) {
+        // Product of consecutive primes lower than the base
+        bnl::ulint product = primes.list[i];
+        std::size_t j = i + 1;
+        while ((j < count) && (product * primes.list[j] < bnl::integer::base))
+            product *= primes.list[j++];
+
+        // One division for the whole group
+        const bnl::ulint rem = bnl::mpn::mod_1(data, size, product);
+        for (; i < j; i++)
+            ans[i] = rem % primes.list[i];
+    }
+}
+
+// Jacobi symbol of two machine words with odd n
+static int jacobi(bnl::ulint a, bnl::ulint n) {
+    int ans = 1;
+    a %= n;
+
+    while (a) {
+        // Factors of two, (2 / n) = -1 if n = 3 or n = 5 modulo 8
+        while (!(a & 1)) {
+            a >>= 1;
+            if (((n & 7) == 3) || ((n & 7) == 5))
+                ans = -ans;
+        }
+
+        // Quadratic reciprocity
+        const bnl::ulint tmp = a;
+        a = n;
+        n = tmp;
+
+        if (((a & 3) == 3) && ((n & 3) == 3))
+            ans = -ans;
+
+        a %= n;
+    }
+
+    return n == 1 ? ans : 0;
+}
+
+// Jacobi symbol of an odd signed word over odd numeric data
+static int jacobi(const bnl::lint &a, const bnl::ulint *const data, const std::size_t &size) {
+    const bnl::ulint m = a < 0 ? -a : a;
+    int ans = 1;
+
+    // (-1 / n) = -1 if n = 3 modulo 4
+    if ((a < 0) && ((data[0] & 3) == 3))
+        ans = -ans;
+
+    // Quadratic reciprocity
+    if (((m & 3) == 3) && ((data[0] & 3) == 3))
+        ans = -ans;
+
+    return ans * jacobi(bnl::mpn::mod_1(data, size, m), m);
+}
+
+
+// Modular arithmetic functions
+
+// Least positive representative modulo the context modulus
+static const bnl::integer normalize(const bnl::integer &n, const bnl::barrett &ctx) {
+    const bnl::integer ans = n % ctx;
+    return bnl::isneg(ans) ? ans + ctx.modulus() : ans;
+}
+
+// Half of a number modulo an odd context modulus
+static const bnl::integer half(const bnl::integer &n, const bnl::barrett &ctx) {
+    return (bnl::isodd(n) ? n + ctx.modulus() : n) >> bnl::integer::one;
+}
+
+// Miller-Rabin strong probable prime test with n - 1 = d * 2^s
+static bool strong_fermat(const bnl::barrett &ctx, const bnl::integer &base, const bnl::integer &n1, const bnl::integer &d, const std::size_t &s) {
+    bnl::integer x = ctx.pow(base, d);
+    if (bnl::isone(x) || (x == n1))
+        return true;
+
+    // Square up to s - 1 times looking for -1
+    for (std::size_t r = 1; r < s; r++) {
+        x = ctx.reduce(x * x);
+
+        if (x == n1)
+            return true;
+
+        if (bnl::isone(x))
+            return false;
+    }
+
+    return false;
+}
+
+// Strong Lucas probable prime test with P = 1, Q = (1 - D) / 4 and n + 1 = d * 2^s
+static bool strong_lucas(const bnl::barrett &ctx, const bnl::integer &D, const bnl::integer &Q, const bnl::ulint *const d, const std::size_t &d_size, const std::size_t &s) {
+    // Precision of d
+    std::size_t bits = d_size << 5;
+    for (bnl::ulint i = bnl::integer::base >> 1; !(d[d_size - 1] & i); i >>= 1)
+        bits--;
+
+    // Lucas sequences U(1), V(1) and Q^1
+    bnl::integer U = bnl::integer::one;
+    bnl::integer V = bnl::integer::one;
+    bnl::integer Qk = Q;
+
+    // Doubling formulas from the most significative bit of d
+    for (std::size_t i = bits - 2; i < bits; i--) {
+        // U(2k) = U(k) V(k), V(2k) = V(k)^2 - 2 Q^k
+        U = ctx.reduce(U * V);
+        V = normalize(V * V - (Qk + Qk), ctx);
+        Qk = ctx.reduce(Qk * Qk);
+
+        // U(k + 1) = (P U(k) + V(k)) / 2, V(k + 1) = (D U(k) + P V(k)) / 2
+        if ((d[i >> 5] >> (i & 31)) & 1) {
+            const bnl::integer tmp = half(normalize(U + V, ctx), ctx);
+            V = half(normalize(D * U + V, ctx), ctx);
+            U = tmp;
+            Qk = ctx.reduce(Qk * Q);
+        }
+    }
+
+    // U(d) = 0 or V(d) = 0
+    if (bnl::iszero(U) || bnl::iszero(V))
+        return true;
+
+    // V(d 2^r) = 0 for some 0 < r < s
+    for (std::size_t r = 1; r < s; r++) {
+        V = normalize(V * V - (Qk + Qk), ctx);
+        if (bnl::iszero(V))
+            return true;
+
+        Qk = ctx.reduce(Qk * Qk);
+    }
+
+    return false;
+}
+
+
+// Methods
+
+// Returns whether the value is a probable prime
+bool bnl::is_probable_prime(const bnl::integer &n, const std::size_t &reps) {
+    // Numbers lower than two
+    if (n.sign || ((n.size == 1) && (n.data[0] < 2)))
+        return false;
+
+    // Trial division by the small primes
+    std::vector<bnl::ulint> rem;
+    residues(n.data, n.size, trial_primes, rem);
+
+    for (std::size_t i = 0; i < trial_primes; i++)
+        if (!rem[i])
+            return (n.size == 1) && (n.data[0] == primes.list[i]);
+
+    // Numbers without factors lower than its square root
+    const bnl::ulint &last = primes.list[trial_primes - 1];
+    if ((n.size == 1) && (n.data[0] < last * last))
+        return true;
+
+
+    // Baillie-PSW test, first the Miller-Rabin test with base 2
+    const bnl::barrett ctx(n);
+    const bnl::integer n1 = n - bnl::integer::one;
+    const std::size_t s = bnl::mpn::ctz(n1.data, n1.size);
+    const bnl::integer d = n1 >> bnl::integer::word(s);
+
+    if (!strong_fermat(ctx, bnl::integer::word(2), n1, d, s))
+        return false;
+
+    // Perfect squares have no Selfridge's parameter
+    if (bnl::is_perfect_square(n))
+        return false;
+
+    // Selfridge's parameter, first D in 5, -7, 9, -11, ... with (D / n) = -1
+    bnl::lint D = 5;
+    for (int j = jacobi(D, n.data, n.size); j != -1; j = jacobi(D, n.data, n.size)) {
+        // Factor of n
+        if (!j)
+            return false;
+
+        D = D > 0 ? -(D + 2) : -(D - 2);
+    }
+
+    // Strong Lucas test
+    const bnl::lint Q = (1 - D) / 4;
+    const bnl::integer n2 = n + bnl::integer::one;
+    const std::size_t t = bnl::mpn::ctz(n2.data, n2.size);
+    const bnl::integer e = n2 >> bnl::integer::word(t);
+    const bnl::integer D_mod = normalize(bnl::integer::word(D < 0 ? -D : D, D < 0), ctx);
+    const bnl::integer Q_mod = normalize(bnl::integer::word(Q < 0 ? -Q : Q, Q < 0), ctx);
+
+    if (!strong_lucas(ctx, D_mod, Q_mod, e.data, e.size, t))
+        return false;
+
+
+    // Additional Miller-Rabin tests with the next prime bases
+    for (std::size_t i = 1; i <= reps; i++)
+        if (!strong_fermat(ctx, bnl::integer::word(primes.list[i]), n1, d, s))
+            return false;
+
+    return true;
+}
+
+// Returns the smallest prime greater than the value
+const bnl::integer bnl::next_prime(const bnl::integer &n) {
+    // Numbers lower than two
+    if (n.sign || ((n.size == 1) && (n.data[0] < 2)))
+        return bnl::integer::word(2);
+
+    // First odd candidate
+    bnl::integer start = n + bnl::integer::word(bnl::isodd(n) ? 2 : 1);
+
+    // Sieve windows over the odd candidates
+    const std::size_t count = sieve_window >> 1;
+    std::vector<bool> composite;
+    std::vector<bnl::ulint> rem;
+
+    for (;;) {
+        // Remove the multiples of the odd small primes
+        composite.assign(count, false);
+        residues(start.data, start.size, primes.list.size(), rem);
+
+        for (std::size_t i = 1; i < primes.list.size(); i++) {
+            const bnl::ulint &p = primes.list[i];
+
+            // First candidate start + 2k = 0 modulo p
+            bnl::ulint k = (p - rem[i]) % p * ((p + 1) >> 1) % p;
+
+            // The prime itself is not composite
+            if ((start.size == 1) && (start.data[0] + (k << 1) == p))
+                k += p;
+
+            for (; k < count; k += p)
+                composite[k] = true;
+        }
+
+        // Test the remaining candidates
+        for (std::size_t k = 0; k < count; k++) {
+            if (composite[k])
+                continue;
+
+            const bnl::integer candidate = start + bnl::integer::word(k << 1);
+            if (bnl::is_probable_prime(candidate))
+                return candidate;
+        }
+
+        // Next window
+        start += bnl::integer::word(count << 1);
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef __BNL_PRIME_HPP_
+#define __BNL_PRIME_HPP_
+
+#include "integer.hpp" // bnl::integer
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Prime functions
+    bool is_probable_prime(const bnl::integer &n, const std::size_t &reps = 0);
+    const bnl::integer next_prime(const bnl::integer &n);
+}
+
+#endif // __BNL_PRIME_HPP_
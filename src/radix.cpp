@@ -0,0 +1,328 @@
+#include "radix.hpp"
+#include "parallel.hpp" // bnl::parallel, bnl::is_parallel, bnl::task_t
+#include "tuning.hpp"   // bnl::thresholds
+
+
+// Sizes
+
+// Decimal chunk base, 10^9
+static const bnl::ulint chunk_base = 1000000000;
+
+
+// Private static methods
+
+// The magnitude times base^blocks
+const bnl::integer bnl::radix::shift(const bnl::integer &n, const std::size_t &blocks) {
+    // Zero is not shifted
+    if (bnl::iszero(n))
+        return bnl::integer::zero;
+
+    // Copy the blocks over the lowest zero blocks
+    bnl::integer ans(n.size + blocks, false);
+    bnl::integer::cpy(ans.data + blocks, n.data, n.size);
+
+    // Return the answer
+    return ans;
+}
+
+// Approximation of floor(base^s / d) within a few units, by Newton's iteration
+// over the reciprocal of half precision
+const bnl::integer bnl::radix::reciprocal(const bnl::integer_view &d, const std::size_t &s) {
+    // Size of the reciprocal
+    const std::size_t e = s - d.size;
+
+    // Only the highest e + 2 data blocks of the divisor are significative
+    if (d.size > e + 2) {
+        const std::size_t t = d.size - e - 2;
+        return bnl::radix::reciprocal(d.high(t), s - t);
+    }
+
+    // Small reciprocals by long division
+    if (e < bnl::thresholds().reciprocal)
+        return bnl::radix::shift(bnl::integer::one, s) / d;
+
+    // Reciprocal y of half precision, x = y base^(e - h) at full precision
+    const std::size_t h = (e >> 1) + 1;
+    const bnl::integer y = bnl::radix::reciprocal(d, d.size + h);
+    const bnl::integer x = bnl::radix::shift(y, e - h);
+
+    // Newton's iteration, x + x (base^s - d x) / base^s. The lowest zero blocks
+    // of x are left out of both products
+    const bnl::integer err = bnl::radix::shift(bnl::integer::one, d.size + h) - d * y;
+    const bnl::integer fix(bnl::integer_view(y * bnl::abs(err)).high(d.size + (h << 1) - e));
+
+    return err.sign ? x - fix : x + fix;
+}
+
+// Split of a number in decimal chunks, run by a worker. The tasks reserve their
+// numbers from the global allocator, the running thread may be waiting with the
+// scoped allocator of another computation
+void bnl::radix::split_task(void *const arg) {
+    const bnl::allocator::scope scope(bnl::allocator::global());
+    split_t &args = *static_cast<split_t *>(arg);
+
+    args.count = args.context->split(*args.n, args.level, args.chunks, args.pad);
+}
+
+// Join of decimal chunks in a number, run by a worker
+void bnl::radix::join_task(void *const arg) {
+    const bnl::allocator::scope scope(bnl::allocator::global());
+    const join_t &args = *static_cast<const join_t *>(arg);
+
+    *args.n = args.context->join(args.chunks, args.count);
+}
+
+// Reciprocal of a power, run by a worker
+void bnl::radix::reciprocal_task(void *const arg) {
+    const bnl::allocator::scope scope(bnl::allocator::global());
+    const reciprocal_t &args = *static_cast<const reciprocal_t *>(arg);
+
+    *args.ans = bnl::radix::reciprocal(*args.power, args.s);
+}
+
+
+// Private methods
+
+// Whether the magnitude is lower than the power of the given level
+bool bnl::radix::less(const bnl::integer_view &n, const std::size_t &level) const {
+    const bnl::integer &power = powers[level];
+    const std::size_t size = power.size + zeros[level];
+
+    // Check sizes
+    if (n.size != size)
+        return n.size < size;
+
+    // The lowest blocks of the power are zero
+    for (std::size_t i = power.size - 1; i < power.size; i--)
+        if (n.data[i + zeros[level]] != power.data[i])
+            return n.data[i + zeros[level]] < power.data[i];
+
+    return false;
+}
+
+// Quotient and remainder of the magnitude, lower than the squared power of the
+// given level, divided by the power
+void bnl::radix::divrem(const bnl::integer_view &n, const std::size_t &level, bnl::integer &quot, bnl::integer &rem) const {
+    const bnl::integer &power = powers[level];
+    const bnl::integer &mu = reciprocals[level];
+    const std::size_t &z = zeros[level];
+    const std::size_t d = power.size;
+
+    // The lowest zero blocks of the power only move the lowest blocks of the
+    // magnitude to the remainder, both are views of the magnitude
+    const bnl::integer_view top = n.high(z);
+
+    // Quotient estimation, a few units smaller or larger than the real one
+    quot = bnl::integer(bnl::integer_view(top.high(d - 1) * mu).high(d + z + 1));
+    bnl::integer r = top - quot * power;
+
+    // Final corrections
+    while (r.sign) {
+        r += power;
+        --quot;
+    }
+
+    while (bnl::integer::cmpabs(r, power) >= 0) {
+        r -= power;
+        ++quot;
+    }
+
+    rem = bnl::radix::shift(r, z) + n.low(z);
+}
+
+// Decimal chunks of the magnitude, lower than the squared power of the given
+// level, returns the number of chunks
+std::size_t bnl::radix::split(const bnl::integer_view &n, const std::size_t &level, bnl::ulint *const chunks, const bool &pad) const {
+    // Small numbers by short division, padded to the level size
+    if (n.size < bnl::thresholds().short_division) {
+        const bnl::scratch mem(n.size);
+        bnl::ulint *const num = mem.data();
+        bnl::integer::cpy(num, n.data, n.size);
+
+        // Short division by the chunk base from the most significative block
+        std::size_t size = n.size;
+        std::size_t count = 0;
+        do {
+            bnl::ulint rem = 0;
+            for (std::size_t i = size - 1; i < size; i--) {
+                rem = (rem << 32) | num[i];
+                num[i] = rem / chunk_base;
+                rem %= chunk_base;
+            }
+
+            chunks[count++] = rem;
+
+            while (size && !num[size - 1])
+                size--;
+        } while (size);
+
+        if (pad)
+            for (; count < static_cast<std::size_t>(2) << level; count++)
+                chunks[count] = 0;
+
+        return count;
+    }
+
+    // Highest power not larger than the magnitude if it isn't padded
+    std::size_t k = level;
+    while (!pad && k && less(n, k))
+        k--;
+
+    // The remainder has 2^k chunks padded with zeros, followed by the quotient
+    bnl::integer quot, rem;
+    divrem(n, k, quot, rem);
+
+    split_t args[2] = {
+        {this, &rem, k - 1, chunks, true, 0},
+        {this, &quot, k - 1, chunks + (static_cast<std::size_t>(1) << k), pad, 0}
+    };
+
+    // Both halves run by the workers if the magnitude is large enough
+    if (bnl::is_parallel(n.size)) {
+        const bnl::task_t tasks[2] = {
+            {bnl::radix::split_task, &args[0]},
+            {bnl::radix::split_task, &args[1]}
+        };
+
+        bnl::parallel(tasks, 2);
+    }
+    else {
+        args[0].count = split(rem, k - 1, args[0].chunks, true);
+        args[1].count = split(quot, k - 1, args[1].chunks, pad);
+    }
+
+    return args[0].count + args[1].count;
+}
+
+// Number from its decimal chunks
+const bnl::integer bnl::radix::join(const bnl::ulint *const chunks, const std::size_t &count) const {
+    // Few chunks, multiply and accumulate from the most significative
+    if (count < bnl::thresholds().join) {
+        bnl::integer ans(count, false);
+        std::size_t size = 1;
+
+        for (std::size_t i = count - 1; i < count; i--) {
+            bnl::ulint carry = chunks[i];
+            for (std::size_t j = 0; j < size; j++) {
+                const bnl::ulint product = ans.data[j] * chunk_base + carry;
+                ans.data[j] = product & bnl::integer::base_mask;
+                carry = product >> 32;
+            }
+
+            if (carry)
+                ans.data[size++] = carry;
+        }
+
+        ans.shrink();
+        return ans;
+    }
+
+    // Highest power with less chunks than the number
+    std::size_t k = powers.size() - 1;
+    while (static_cast<std::size_t>(1) << k >= count)
+        k--;
+
+    // The lowest 2^k chunks and the highest ones
+    const std::size_t half = static_cast<std::size_t>(1) << k;
+    if (!bnl::is_parallel(half))
+        return bnl::radix::shift(join(chunks + half, count - half) * powers[k], zeros[k]) + join(chunks, half);
+
+    // Both halves run by the workers, the numbers assigned by them are
+    // reserved from the global allocator
+    const bnl::allocator::scope scope(bnl::allocator::global());
+    bnl::integer lo, hi;
+
+    join_t args[2] = {
+        {this, chunks, half, &lo},
+        {this, chunks + half, count - half, &hi}
+    };
+    const bnl::task_t tasks[2] = {
+        {bnl::radix::join_task, &args[0]},
+        {bnl::radix::join_task, &args[1]}
+    };
+
+    bnl::parallel(tasks, 2);
+
+    // hi 10^(9 2^k) + lo
+    return bnl::radix::shift(hi * powers[k], zeros[k]) + lo;
+}
+
+
+// Constructors
+
+// Context for the numbers of up to the given size in data blocks, with the
+// reciprocals needed to convert them to decimal if division is set
+bnl::radix::radix(const std::size_t &blocks, const bool &division) : powers(), zeros(), reciprocals() {
+    // Powers not larger than the numbers, each one is the square of the
+    // previous one with its lowest zero blocks removed
+    bnl::integer power = bnl::integer::word(chunk_base);
+    std::size_t z = 0;
+
+    while (power.size + z <= blocks) {
+        std::size_t low = 0;
+        while (!power.data[low])
+            low++;
+
+        z += low;
+        powers.push_back(bnl::integer(bnl::integer_view(power).high(low)));
+        zeros.push_back(z);
+
+        // The next power has at least twice the size minus one
+        const bnl::integer &last = powers.back();
+        if ((last.size << 1) - 1 + (z << 1) > blocks)
+            break;
+
+        power = last * last;
+        z <<= 1;
+    }
+
+    // The first power is always needed to split the numbers
+    if (powers.empty()) {
+        powers.push_back(bnl::integer::word(chunk_base));
+        zeros.push_back(0);
+    }
+
+    if (!division)
+        return;
+
+
+    // Reciprocals of each power, the dividend of each one has twice the power
+    // size plus its zero blocks
+    const std::size_t levels = powers.size();
+    if (!bnl::is_parallel(blocks)) {
+        for (std::size_t i = 0; i < levels; i++)
+            reciprocals.push_back(bnl::radix::reciprocal(powers[i], (powers[i].size << 1) + zeros[i]));
+
+        return;
+    }
+
+    // Independent of each other, run by the workers. The numbers assigned by
+    // them are reserved from the global allocator
+    const bnl::allocator::scope scope(bnl::allocator::global());
+    reciprocals.resize(levels);
+
+    std::vector<reciprocal_t> args(levels);
+    std::vector<bnl::task_t> tasks(levels);
+    for (std::size_t i = 0; i < levels; i++) {
+        const reciprocal_t arg = {&powers[i], (powers[i].size << 1) + zeros[i], &reciprocals[i]};
+        const bnl::task_t task = {bnl::radix::reciprocal_task, &args[i]};
+        args[i] = arg;
+        tasks[i] = task;
+    }
+
+    bnl::parallel(&tasks[0], levels);
+}
+
+
+// Methods
+
+// Decimal chunks of 9 digits of the magnitude from the least significative,
+// returns the number of chunks
+std::size_t bnl::radix::chunks(const bnl::integer_view &n, bnl::ulint *const ans) const {
+    return split(n, powers.size() - 1, ans, false);
+}
+
+// Number from its decimal chunks of 9 digits from the least significative
+const bnl::integer bnl::radix::value(const bnl::ulint *const chunks, const std::size_t &count) const {
+    return join(chunks, count);
+}
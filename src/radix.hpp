@@ -0,0 +1,134 @@
+#ifndef __BNL_RADIX_HPP_
+#define __BNL_RADIX_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::integer_view
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Divide and conquer decimal conversion context. The number is split by the
+    // powers 10^(9 2^k), computed once with their reciprocals and shared read
+    // only by the workers that convert the independent halves
+    class radix {
+        private:
+            // Split of a number in decimal chunks, run by a worker
+            struct split_t {
+                // Conversion context
+                const bnl::radix *context;
+
+                // Number to split
+                const bnl::integer *n;
+
+                // Level of the power that splits the number
+                std::size_t level;
+
+                // Decimal chunks from the least significative
+                bnl::ulint *chunks;
+
+                // Whether the chunks are padded with zeros to the level size
+                bool pad;
+
+                // Number of chunks written
+                std::size_t count;
+            };
+
+            // Join of decimal chunks in a number, run by a worker
+            struct join_t {
+                // Conversion context
+                const bnl::radix *context;
+
+                // Decimal chunks from the least significative
+                const bnl::ulint *chunks;
+
+                // Number of chunks
+                std::size_t count;
+
+                // Joined number
+                bnl::integer *n;
+            };
+
+            // Reciprocal of a power, run by a worker
+            struct reciprocal_t {
+                // Power
+                const bnl::integer *power;
+
+                // Exponent of the dividend base^s
+                std::size_t s;
+
+                // Reciprocal floor(base^s / power)
+                bnl::integer *ans;
+            };
+
+
+            // Attributes
+
+            // Powers 10^(9 2^k) without their lowest zero data blocks
+            std::vector<bnl::integer> powers;
+
+            // Lowest zero data blocks of each power
+            std::vector<std::size_t> zeros;
+
+            // Reciprocals floor(base^(2 size + zeros) / power) of each power
+            // without its zero data blocks, so the quotient of any number lower
+            // than the power squared is estimated with two products
+            std::vector<bnl::integer> reciprocals;
+
+
+            // Static methods
+
+            // The magnitude times base^blocks
+            static const bnl::integer shift(const bnl::integer &n, const std::size_t &blocks);
+
+            // Approximation of floor(base^s / d) within a few units, by Newton's
+            // iteration over the reciprocal of half precision
+            static const bnl::integer reciprocal(const bnl::integer_view &d, const std::size_t &s);
+
+            // Workers tasks
+            static void split_task(void *const arg);
+            static void join_task(void *const arg);
+            static void reciprocal_task(void *const arg);
+
+
+            // Methods
+
+            // Whether the magnitude is lower than the power of the given level
+            bool less(const bnl::integer_view &n, const std::size_t &level) const;
+
+            // Quotient and remainder of the magnitude, lower than the squared
+            // power of the given level, divided by the power
+            void divrem(const bnl::integer_view &n, const std::size_t &level, bnl::integer &quot, bnl::integer &rem) const;
+
+            // Decimal chunks of the magnitude, lower than the squared power of
+            // the given level, returns the number of chunks
+            std::size_t split(const bnl::integer_view &n, const std::size_t &level, bnl::ulint *const chunks, const bool &pad) const;
+
+            // Number from its decimal chunks
+            const bnl::integer join(const bnl::ulint *const chunks, const std::size_t &count) const;
+
+
+        public:
+            // Constructors
+
+            // Context for the numbers of up to the given size in data blocks,
+            // with the reciprocals needed to convert them to decimal if
+            // division is set
+            explicit radix(const std::size_t &blocks, const bool &division = true);
+
+
+            // Methods
+
+            // Decimal chunks of 9 digits of the magnitude from the least
+            // significative, returns the number of chunks. The answer has at
+            // least n + n / 8 + 2 blocks for a number of n data blocks
+            std::size_t chunks(const bnl::integer_view &n, bnl::ulint *const ans) const;
+
+            // Number from its decimal chunks of 9 digits from the least
+            // significative
+            const bnl::integer value(const bnl::ulint *const chunks, const std::size_t &count) const;
+    };
+}
+
+#endif // __BNL_RADIX_HPP_
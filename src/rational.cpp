@@ -0,0 +1,282 @@
+#include "rational.hpp"
+#include "gcd.hpp" // bnl::gcd
+
+#include <algorithm> // std::max
+#include <stdexcept> // std::invalid_argument
+
+
+// Constants
+
+// Growth factor of the size of a fraction, since it or its operands were
+// reduced, that reduces it again
+static const std::size_t growth = 2;
+
+
+// Private constructors
+
+// Fraction of terms already normalized, with the base size
+bnl::rational::rational(const bnl::integer &num, const bnl::integer &den, const bool &reduced, const std::size_t &base) : num(num), den(den), reduced(reduced), base(reduced ? num.size + den.size : base) {}
+
+
+// Private static methods
+
+// Sum or difference of two fractions
+const bnl::rational bnl::rational::sum(const bnl::rational &a, const bnl::rational &b, const bool &sub) {
+    // Second numerator with its sign, sharing the numeric data
+    const bnl::integer bn = sub ? -b.num : b.num;
+    const std::size_t base = std::max(a.base, b.base);
+
+    // Integer addends keep the lowest terms of the other fraction
+    if (bnl::isone(b.den)) {
+        bnl::rational ans(a.num + bn * a.den, a.den, a.reduced, base);
+        ans.grow();
+        return ans;
+    }
+
+    if (bnl::isone(a.den)) {
+        bnl::rational ans(a.num * b.den + bn, b.den, b.reduced, base);
+        ans.grow();
+        return ans;
+    }
+
+    // Same denominator
+    if (a.den == b.den) {
+        bnl::rational ans(a.num + bn, a.den, false, base);
+        ans.grow();
+        return ans;
+    }
+
+
+    // Coprime denominators, the sum of fractions in their lowest terms is in
+    // its lowest terms
+    const bnl::integer g = bnl::gcd(a.den, b.den);
+    if (bnl::isone(g)) {
+        bnl::rational ans(a.num * b.den + bn * a.den, a.den * b.den, a.reduced && b.reduced, base);
+        ans.grow();
+        return ans;
+    }
+
+    // Cross products by the cofactors of the gcd of the denominators, so the
+    // products and the denominator are smaller
+    const bnl::integer a_den = a.den / g;
+    const bnl::integer num = a.num * (b.den / g) + bn * a_den;
+
+    // The common factors of the sum of fractions in their lowest terms divide
+    // the gcd of the denominators, which is small
+    if (a.reduced && b.reduced) {
+        const bnl::integer h = bnl::gcd(num, g);
+        return bnl::rational(num / h, a_den * (b.den / h), true, base);
+    }
+
+    bnl::rational ans(num, a_den * b.den, false, base);
+    ans.grow();
+    return ans;
+}
+
+
+// Private methods
+
+// Reduce to the lowest terms, if it isn't already
+void bnl::rational::reduce() const {
+    if (reduced)
+        return;
+
+    // Divide both terms by their greatest common divisor, exactly
+    const bnl::integer g = bnl::gcd(num, den);
+    if (!bnl::isone(g)) {
+        num = num / g;
+        den = den / g;
+    }
+
+    reduced = true;
+    base = num.size + den.size;
+}
+
+// Reduce to the lowest terms if it grew past the factor of the base
+void bnl::rational::grow() const {
+    if (!reduced && (num.size + den.size > growth * base))
+        reduce();
+}
+
+
+// Public constructors
+
+// Zero
+bnl::rational::rational() : num(), den(bnl::integer::one), reduced(true), base(2) {}
+
+// Constructor from an integer
+bnl::rational::rational(const bnl::integer &n) : num(n), den(bnl::integer::one), reduced(true), base(n.size + 1) {}
+
+// Constructor from the numerator and the denominator
+bnl::rational::rational(const bnl::integer &num, const bnl::integer &den) : num(num), den(den), reduced(false), base(num.size + den.size) {
+    // Check the denominator
+    if (bnl::iszero(den))
+        throw std::invalid_argument("can't build bnl::rational: denominator is zero");
+
+    // The sign is kept in the numerator
+    if (bnl::isneg(den)) {
+        this->num = -num;
+        this->den = -den;
+    }
+}
+
+// Constructor from a std::string with a numerator and an optional denominator
+bnl::rational::rational(const std::string &str) : num(), den(bnl::integer::one), reduced(false), base(2) {
+    const std::size_t slash = str.find('/');
+    if (slash == std::string::npos)
+        *this = bnl::rational(bnl::integer(str));
+    else
+        *this = bnl::rational(bnl::integer(str.substr(0, slash)), bnl::integer(str.substr(slash + 1)));
+}
+
+// Constructor from a C string, like the std::string one
+bnl::rational::rational(const char *const str) : num(), den(bnl::integer::one), reduced(false), base(2) {
+    *this = bnl::rational(std::string(str));
+}
+
+
+// Methods
+
+// The numerator of the lowest terms, with the sign
+const bnl::integer &bnl::rational::numerator() const {
+    reduce();
+    return num;
+}
+
+// The denominator of the lowest terms, always positive
+const bnl::integer &bnl::rational::denominator() const {
+    reduce();
+    return den;
+}
+
+
+// Helpful arithmetic functions
+
+// Returns the absolute value
+const bnl::rational bnl::abs(const bnl::rational &n) {
+    return bnl::rational(bnl::abs(n.num), n.den, n.reduced, n.base);
+}
+
+
+// Other helpful functions
+
+// Get the string representation, the denominator is left out if it's one
+const std::string bnl::str(const bnl::rational &n) {
+    n.reduce();
+    return bnl::isone(n.den) ? bnl::str(n.num) : bnl::str(n.num) + "/" + bnl::str(n.den);
+}
+
+
+// Operators overloading
+
+// Increment and decrement operators
+
+// Postfix increment
+const bnl::rational bnl::rational::operator ++ (int) {
+    const bnl::rational ans = *this;
+    ++*this;
+    return ans;
+}
+
+// Postfix decrement
+const bnl::rational bnl::rational::operator -- (int) {
+    const bnl::rational ans = *this;
+    --*this;
+    return ans;
+}
+
+
+// Arithmetic operators
+
+// Multiplication, the product of the terms is only reduced if it grew too much
+const bnl::rational operator * (const bnl::rational &a, const bnl::rational &b) {
+    bnl::rational ans(a.num * b.num, a.den * b.den, bnl::isone(a.den) && bnl::isone(b.den), std::max(a.base, b.base));
+    ans.grow();
+    return ans;
+}
+
+// Division, the product of the terms is only reduced if it grew too much
+const bnl::rational operator / (const bnl::rational &a, const bnl::rational &b) {
+    // Check the divisor
+    if (bnl::iszero(b.num))
+        throw std::invalid_argument("can't divide: division by zero");
+
+    // The sign of the divisor goes to the numerator
+    const bnl::integer num = a.num * b.den;
+    bnl::rational ans(bnl::isneg(b.num) ? -num : num, a.den * bnl::abs(b.num), false, std::max(a.base, b.base));
+    ans.grow();
+    return ans;
+}
+
+// Addition
+const bnl::rational operator + (const bnl::rational &a, const bnl::rational &b) {
+    return bnl::rational::sum(a, b, false);
+}
+
+// Subtraction
+const bnl::rational operator - (const bnl::rational &a, const bnl::rational &b) {
+    return bnl::rational::sum(a, b, true);
+}
+
+
+// Input and output
+
+// Standard output of the lowest terms
+std::ostream &operator << (std::ostream &stream, const bnl::rational &n) {
+    return stream << bnl::str(n);
+}
+
+// Standard input of a numerator and an optional denominator after a slash
+std::istream &operator >> (std::istream &stream, bnl::rational &n) {
+    bnl::integer num;
+    bnl::integer den = bnl::integer::one;
+    if (!(stream >> num))
+        return stream;
+
+    // Denominator
+    if (stream.good() && (stream.peek() == '/')) {
+        stream.get();
+        if (!(stream >> den))
+            return stream;
+
+        if (bnl::iszero(den)) {
+            stream.setstate(std::ios::failbit);
+            return stream;
+        }
+    }
+
+    n = bnl::rational(num, den);
+    return stream;
+}
+
+
+// Comparison and relational operators
+
+// Greater than
+bool operator > (const bnl::rational &a, const bnl::rational &b) {
+    return b < a;
+}
+
+// Less than, the cross products of the lowest terms
+bool operator < (const bnl::rational &a, const bnl::rational &b) {
+    a.reduce();
+    b.reduce();
+
+    // Different signs
+    if (bnl::isneg(a.num) != bnl::isneg(b.num))
+        return bnl::isneg(a.num);
+
+    // Same denominator
+    if (a.den == b.den)
+        return a.num < b.num;
+
+    return a.num * b.den < b.num * a.den;
+}
+
+// Equal to, the lowest terms are unique
+bool operator == (const bnl::rational &a, const bnl::rational &b) {
+    a.reduce();
+    b.reduce();
+
+    return (a.num == b.num) && (a.den == b.den);
+}
@@ -0,0 +1,240 @@
+#ifndef __BNL_RATIONAL_HPP_
+#define __BNL_RATIONAL_HPP_
+
+#include "integer.hpp" // bnl::integer
+
+#include <cstddef> // std::size_t
+#include <istream> // std::istream
+#include <ostream> // std::ostream
+#include <string>  // std::string
+
+
+// Forward declaration of the bnl::rational class
+namespace bnl {
+    class rational;
+}
+
+
+// Arithmetic operators
+const bnl::rational operator * (const bnl::rational &a, const bnl::rational &b);
+const bnl::rational operator / (const bnl::rational &a, const bnl::rational &b);
+const bnl::rational operator + (const bnl::rational &a, const bnl::rational &b);
+const bnl::rational operator - (const bnl::rational &a, const bnl::rational &b);
+
+// Input and output
+std::ostream &operator << (std::ostream &stream, const bnl::rational &n);
+std::istream &operator >> (std::istream &stream, bnl::rational &n);
+
+// Comparison and relational operators
+bool operator > (const bnl::rational &a, const bnl::rational &b);
+bool operator < (const bnl::rational &a, const bnl::rational &b);
+bool operator >= (const bnl::rational &a, const bnl::rational &b);
+bool operator <= (const bnl::rational &a, const bnl::rational &b);
+bool operator == (const bnl::rational &a, const bnl::rational &b);
+bool operator != (const bnl::rational &a, const bnl::rational &b);
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Helpful arithmetic functions
+    const bnl::rational abs(const bnl::rational &n);
+
+    // Other helpful functions
+    std::string const str(const bnl::rational &n);
+
+
+    // Exact fraction of arbitrary precision integers, reduced to its lowest
+    // terms lazily: when its size grows past twice the size of its operands
+    // since they were reduced, and when it is compared, written or its terms
+    // are asked for. The denominator is always positive
+    class rational {
+        private:
+            // Attributes
+
+            // Numerator, with the sign of the fraction
+            mutable bnl::integer num;
+
+            // Denominator, always positive
+            mutable bnl::integer den;
+
+            // Whether the fraction is in its lowest terms
+            mutable bool reduced;
+
+            // Data blocks of both terms when the fraction or its operands were
+            // last reduced, the size its growth is measured from
+            mutable std::size_t base;
+
+
+            // Constructors
+
+            // Fraction of terms already normalized, with the base size
+            rational(const bnl::integer &num, const bnl::integer &den, const bool &reduced, const std::size_t &base);
+
+
+            // Static methods
+
+            // Sum or difference of two fractions
+            static const bnl::rational sum(const bnl::rational &a, const bnl::rational &b, const bool &sub);
+
+
+            // Methods
+
+            // Reduce to the lowest terms, if it isn't already
+            void reduce() const;
+
+            // Reduce to the lowest terms if it grew past the factor of the base
+            void grow() const;
+
+
+        public:
+            // Constructors
+
+            // Zero
+            rational();
+
+            // Constructor from an integer
+            rational(const bnl::integer &n);
+
+            // Constructor from the numerator and the denominator
+            rational(const bnl::integer &num, const bnl::integer &den);
+
+            // Constructor from a std::string with a numerator and an optional
+            // denominator after a slash
+            rational(const std::string &str);
+
+            // Constructor from a C string, like the std::string one
+            rational(const char *const str);
+
+
+            // Methods
+
+            // The numerator of the lowest terms, with the sign
+            const bnl::integer &numerator() const;
+
+            // The denominator of the lowest terms, always positive
+            const bnl::integer &denominator() const;
+
+
+            // Returns the absolute value
+            friend const bnl::rational abs(const bnl::rational &n);
+
+            // Get the string representation
+            friend const std::string str(const bnl::rational &n);
+
+
+            // Operators overloading
+
+            // Increment and decrement operators
+
+            // Postfix increment
+            const bnl::rational operator ++ (int);
+
+            // Postfix decrement
+            const bnl::rational operator -- (int);
+
+            // Prefix increment, the lowest terms are kept
+            inline const bnl::rational &operator ++ () {
+                num += den;
+                return *this;
+            }
+
+            // Prefix decrement, the lowest terms are kept
+            inline const bnl::rational &operator -- () {
+                num -= den;
+                return *this;
+            }
+
+
+            // Unary operators
+
+            // Rational promotion
+            inline const bnl::rational &operator + () const {
+                return *this;
+            }
+
+            // Additive inverse
+            inline const bnl::rational operator - () const {
+                return bnl::rational(-num, den, reduced, base);
+            }
+
+            // Logical NOT
+            inline bool operator ! () const {
+                return bnl::iszero(num);
+            }
+
+
+            // Arithmetic operators
+
+            // Multiplication
+            friend const bnl::rational (::operator *) (const bnl::rational &a, const bnl::rational &b);
+
+            // Division
+            friend const bnl::rational (::operator /) (const bnl::rational &a, const bnl::rational &b);
+
+            // Addition
+            friend const bnl::rational (::operator +) (const bnl::rational &a, const bnl::rational &b);
+
+            // Subtraction
+            friend const bnl::rational (::operator -) (const bnl::rational &a, const bnl::rational &b);
+
+
+            // Input and output
+
+            // Standard output
+            friend std::ostream &::operator << (std::ostream &stream, const bnl::rational &n);
+
+            // Standard input
+            friend std::istream &::operator >> (std::istream &stream, bnl::rational &n);
+
+
+            // Comparison and relational operators
+
+            // Greater than
+            friend bool ::operator > (const bnl::rational &a, const bnl::rational &b);
+
+            // Less than
+            friend bool ::operator < (const bnl::rational &a, const bnl::rational &b);
+
+            // Equal to
+            friend bool ::operator == (const bnl::rational &a, const bnl::rational &b);
+
+
+            // Assignment operators
+
+            // Assignation by multiplication
+            inline bnl::rational &operator *= (const bnl::rational &n) {
+                return *this = *this * n;
+            }
+
+            // Assignation by division
+            inline bnl::rational &operator /= (const bnl::rational &n) {
+                return *this = *this / n;
+            }
+
+            // Assignation by addition
+            inline bnl::rational &operator += (const bnl::rational &n) {
+                return *this = *this + n;
+            }
+
+            // Assignation by subtraction
+            inline bnl::rational &operator -= (const bnl::rational &n) {
+                return *this = *this - n;
+            }
+    };
+}
+
+
+// Comparison and relational operators
+inline bool operator >= (const bnl::rational &a, const bnl::rational &b) {
+    return !(a < b);
+}
+
+inline bool operator <= (const bnl::rational &a, const bnl::rational &b) {
+    return !(a > b);
+}
+
+inline bool operator != (const bnl::rational &a, const bnl::rational &b) {
+    return !(a == b);
+}
+
+#endif // __BNL_RATIONAL_HPP_
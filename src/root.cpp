@@ -0,0 +1,203 @@
+#include "root.hpp"
+
+#include <stdexcept> // std::invalid_argument
+#include <cmath>     // std::sqrt, std::pow
+
+
+// Quadratic residues filters
+
+// Quadratic residues modulo 64, 63, 65 and 11
+static const struct squares_t {
+    // Attributes
+
+    // Whether each remainder is a quadratic residue
+    bool mod64[64];
+    bool mod63[63];
+    bool mod65[65];
+    bool mod11[11];
+
+
+    // Constructors
+
+    // Mark the squares of each remainder
+    squares_t() {
+        for (bnl::ulint i = 0; i < 64; i++) mod64[i] = false;
+        for (bnl::ulint i = 0; i < 63; i++) mod63[i] = false;
+        for (bnl::ulint i = 0; i < 65; i++) mod65[i] = false;
+        for (bnl::ulint i = 0; i < 11; i++) mod11[i] = false;
+
+        for (bnl::ulint i = 0; i < 64; i++) mod64[i * i % 64] = true;
+        for (bnl::ulint i = 0; i < 63; i++) mod63[i * i % 63] = true;
+        for (bnl::ulint i = 0; i < 65; i++) mod65[i * i % 65] = true;
+        for (bnl::ulint i = 0; i < 11; i++) mod11[i * i % 11] = true;
+    }
+} squares;
+
+
+// Machine word functions
+
+// Returns whether x^k is greater than n
+static bool exceeds(const bnl::ulint &x, const bnl::ulint &k, const bnl::ulint &n) {
+    bnl::ulint pow = 1;
+    for (bnl::ulint i = 0; i < k; i++) {
+        // Overflow
+        if (x && (pow > n / x))
+            return true;
+
+        pow *= x;
+    }
+
+    return pow > n;
+}
+
+// Returns whether the number is a small prime
+static bool isprime(const bnl::ulint &n) {
+    for (bnl::ulint i = 2; i * i <= n; i++)
+        if (!(n % i))
+            return false;
+
+    return n >= 2;
+}
+
+
+// Methods
+
+// Returns the integer square root
+const bnl::integer bnl::sqrt(const bnl::integer &n) {
+    return bnl::root(n, 2);
+}
+
+// Returns the integer square root and the remainder
+const bnl::sqrtrem_t bnl::sqrtrem(const bnl::integer &n) {
+    const bnl::integer s = bnl::root(n, 2);
+    return bnl::sqrtrem_t(s, n - s * s);
+}
+
+// Returns the integer k-th root
+const bnl::integer bnl::root(const bnl::integer &n, const bnl::ulint &k) {
+    // Check the index
+    if (!k)
+        throw std::invalid_argument("can't compute root: zero index");
+
+    // Negative number
+    if (n.sign) {
+        if (!(k & 1))
+            throw std::invalid_argument("can't compute root: even root of negative number");
+
+        return -bnl::root(-n, k);
+    }
+
+    // Trivial roots
+    if ((k == 1) || bnl::iszero(n) || bnl::isone(n))
+        return n;
+
+    // Roots lower than two
+    const std::size_t bits = n.precision();
+    if (bits <= k)
+        return bnl::integer::one;
+
+
+    // Hardware root of machine words
+    if (n.size <= 2) {
+        const bnl::ulint word = n.data[0] | (n.size > 1 ? n.data[1] << 32 : 0);
+        const bnl::ldouble approx = k == 2 ? std::sqrt(static_cast<bnl::ldouble>(word)) : std::pow(static_cast<bnl::ldouble>(word), 1.0L / k);
+        bnl::ulint ans = static_cast<bnl::ulint>(approx);
+
+        // Correct the floating point rounding
+        while (exceeds(ans, k, word))
+            ans--;
+
+        while (!exceeds(ans + 1, k, word))
+            ans++;
+
+        return bnl::integer::word(ans);
+    }
+
+
+    // Overestimation from the root of the leading bits, with the half of the
+    // precision of the answer
+    const std::size_t half = bits / k / 2;
+    bnl::integer ans = bnl::integer::word(4);
+
+    if (half) {
+        const bnl::integer shift = bnl::integer::word(half);
+        ans = (bnl::root(n >> bnl::integer::word(k * half), k) + bnl::integer::one) << shift;
+    }
+
+    // Newton's iteration from above, doubles the precision on each step
+    const bnl::integer k0 = bnl::integer::word(k);
+    const bnl::integer k1 = bnl::integer::word(k - 1);
+
+    for (;;) {
+        const bnl::integer next = (k1 * ans + n / bnl::pow(ans, k1)) / k0;
+        if (next >= ans)
+            break;
+
+        ans = next;
+    }
+
+    return ans;
+}
+
+// Returns whether the value is a perfect square
+bool bnl::is_perfect_square(const bnl::integer &n) {
+    // Negative numbers and zero
+    if (n.sign)
+        return false;
+
+    if (bnl::iszero(n))
+        return true;
+
+    // Quadratic residues modulo 64
+    if (!squares.mod64[n.data[0] & 63])
+        return false;
+
+    // Quadratic residues modulo 63 * 65 * 11
+    bnl::ulint rem = 0;
+    for (std::size_t i = n.size - 1; i < n.size; i--)
+        rem = ((rem << 32) | n.data[i]) % 45045;
+
+    if (!squares.mod63[rem % 63] || !squares.mod65[rem % 65] || !squares.mod11[rem % 11])
+        return false;
+
+
+    // Full check
+    const bnl::integer s = bnl::root(n, 2);
+    return s * s == n;
+}
+
+// Returns whether the value is a perfect power
+bool bnl::is_perfect_power(const bnl::integer &n) {
+    // Zero and ones
+    if (bnl::iszero(n) || bnl::isone(n))
+        return true;
+
+    // Magnitude precision and trailing zeros
+    const bnl::integer m = bnl::abs(n);
+    const std::size_t bits = m.precision();
+
+    std::size_t zeros = 0;
+    for (std::size_t i = 0; !m.data[i]; i++)
+        zeros += 32;
+
+    for (bnl::ulint block = m.data[zeros >> 5]; !(block & 1); block >>= 1)
+        zeros++;
+
+
+    // Check each prime exponent, roots lower than two are not possible
+    for (bnl::ulint k = 2; k <= bits; k++) {
+        // Composite exponents and even exponents of negative numbers
+        if (!isprime(k) || (n.sign && (k == 2)))
+            continue;
+
+        // The exponent must divide the trailing zeros of even numbers
+        if (zeros && (zeros % k))
+            continue;
+
+        // Full check
+        if (k == 2 ? bnl::is_perfect_square(m) : bnl::pow(bnl::root(m, k), bnl::integer::word(k)) == m)
+            return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,37 @@
+#ifndef __BNL_ROOT_HPP_
+#define __BNL_ROOT_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::ulint
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Root functions
+    const bnl::integer sqrt(const bnl::integer &n);
+    const bnl::sqrtrem_t sqrtrem(const bnl::integer &n);
+    const bnl::integer root(const bnl::integer &n, const bnl::ulint &k);
+
+    // Root checker functions
+    bool is_perfect_square(const bnl::integer &n);
+    bool is_perfect_power(const bnl::integer &n);
+
+
+    // Structure returned by bnl::sqrtrem
+    struct sqrtrem_t {
+        // Attributes
+
+        // Integer square root
+        bnl::integer root;
+
+        // Remainder, the difference between the number and the square of the root
+        bnl::integer rem;
+
+
+        // Constructors
+
+        // Initializator
+        sqrtrem_t(const bnl::integer &s = bnl::integer::zero, const bnl::integer &r = bnl::integer::zero) : root(s), rem(r) {}
+    };
+}
+
+#endif // __BNL_ROOT_HPP_
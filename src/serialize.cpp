@@ -0,0 +1,199 @@
+#include "serialize.hpp"
+
+#include <algorithm> // std::min
+#include <stdexcept> // std::invalid_argument
+#include <cstring>   // std::memcpy
+#include <ios>       // std::ios
+
+
+// Byte order functions
+
+// Order of the machine for the native order
+static bnl::endian resolve(const bnl::endian &order) {
+    if (order != bnl::native_endian)
+        return order;
+
+    // The lowest byte of one is stored first on little endian machines
+    const bnl::ulint one = 1;
+    return *reinterpret_cast<const bnl::uchar *>(&one) ? bnl::little_endian : bnl::big_endian;
+}
+
+// Position of the i-th least significative byte in a buffer of words
+static std::size_t position(const std::size_t &i, const std::size_t &count, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes) {
+    const std::size_t word = i / size;
+    const std::size_t byte = i % size;
+
+    return (words == bnl::big_endian ? count - 1 - word : word) * size + (bytes == bnl::big_endian ? size - 1 - byte : byte);
+}
+
+
+// Wire format functions
+
+// Largest size in data blocks whose bytes fit in a std::size_t
+static const std::size_t max_blocks = static_cast<std::size_t>(-1) / bnl::ulint_size;
+
+// Data blocks read from a stream at a time
+static const std::size_t wire_chunk = static_cast<std::size_t>(1) << 16;
+
+// Header of the wire format, the size in data blocks with the sign at the
+// lowest bit
+static bnl::ulint header(const std::size_t &size, const bool &sign) {
+    return (static_cast<bnl::ulint>(size) << 1) | (sign ? 1 : 0);
+}
+
+// Returns whether the numeric data is normalized, without leading zero blocks
+// and without negative zero
+static bool normalized(const bnl::ulint *const data, const std::size_t &size, const bool &sign) {
+    for (std::size_t i = 0; i < size; i++)
+        if (data[i] > bnl::integer::base_mask)
+            return false;
+
+    return size > 1 ? data[size - 1] != 0 : data[0] || !sign;
+}
+
+
+// Methods
+
+// Export the magnitude to words of the given size in bytes, zero has no words
+const std::vector<bnl::uchar> bnl::export_bytes(const bnl::integer &n, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes) {
+    // Check the word size
+    if (!size)
+        throw std::invalid_argument("can't export bytes: zero word size");
+
+    // Zero
+    if (bnl::iszero(n))
+        return std::vector<bnl::uchar>();
+
+    // Bytes of the magnitude and number of words
+    const std::size_t length = (n.precision() + 7) >> 3;
+    const std::size_t count = (length + size - 1) / size;
+    const bnl::endian word_order = resolve(words);
+    const bnl::endian byte_order = resolve(bytes);
+
+    // Copy each byte from the least significative, padding with zeros
+    std::vector<bnl::uchar> ans(count * size, 0);
+    for (std::size_t i = 0; i < length; i++)
+        ans[position(i, count, size, word_order, byte_order)] = static_cast<bnl::uchar>(n.data[i >> 2] >> ((i & 3) << 3));
+
+    return ans;
+}
+
+// Import a positive number from the given number of words of the given size
+const bnl::integer bnl::import_bytes(const bnl::uchar *const data, const std::size_t &count, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes) {
+    // Check the word size
+    if (!size)
+        throw std::invalid_argument("can't import bytes: zero word size");
+
+    // Zero
+    const std::size_t length = count * size;
+    if (!length)
+        return bnl::integer::zero;
+
+    // Copy each byte from the least significative
+    const bnl::endian word_order = resolve(words);
+    const bnl::endian byte_order = resolve(bytes);
+    bnl::integer ans((length + 3) >> 2, false);
+
+    for (std::size_t i = 0; i < length; i++)
+        ans.data[i >> 2] |= static_cast<bnl::ulint>(data[position(i, count, size, word_order, byte_order)]) << ((i & 3) << 3);
+
+    // Shrink and return the answer
+    ans.shrink();
+    return ans;
+}
+
+// Import a positive number from a buffer of words of the given size
+const bnl::integer bnl::import_bytes(const std::vector<bnl::uchar> &data, const std::size_t &size, const bnl::endian &words, const bnl::endian &bytes) {
+    // Check the word size
+    if (!size || (data.size() % size))
+        throw std::invalid_argument("can't import bytes: incomplete word");
+
+    return bnl::import_bytes(data.empty() ? NULL : &data[0], data.size() / size, size, words, bytes);
+}
+
+
+// Size in bytes of the wire format
+std::size_t bnl::wire_size(const bnl::integer &n) {
+    return (n.size + 1) * bnl::ulint_size;
+}
+
+// Write the header and the numeric data to the buffer, returns the written bytes
+std::size_t bnl::wire_write(const bnl::integer &n, bnl::uchar *const buffer) {
+    const bnl::ulint head = header(n.size, n.sign);
+    std::memcpy(buffer, &head, bnl::ulint_size);
+    std::memcpy(buffer + bnl::ulint_size, n.data, n.size * bnl::ulint_size);
+
+    return bnl::wire_size(n);
+}
+
+// Read a number from a buffer of the given size in bytes
+const bnl::integer bnl::wire_read(const bnl::uchar *const buffer, const std::size_t &size, std::size_t *const used) {
+    // Header
+    if (size < bnl::ulint_size)
+        throw std::invalid_argument("can't read wire format: truncated header");
+
+    bnl::ulint head;
+    std::memcpy(&head, buffer, bnl::ulint_size);
+
+    // Check the size before reserving any memory
+    const std::size_t blocks = head >> 1;
+    if (!blocks || ((size - bnl::ulint_size) / bnl::ulint_size < blocks))
+        throw std::invalid_argument("can't read wire format: invalid size");
+
+    // Numeric data
+    bnl::integer ans(blocks, head & 1);
+    std::memcpy(ans.data, buffer + bnl::ulint_size, blocks * bnl::ulint_size);
+
+    if (!normalized(ans.data, ans.size, ans.sign))
+        throw std::invalid_argument("can't read wire format: not normalized numeric data");
+
+    // Read bytes
+    if (used)
+        *used = bnl::wire_size(ans);
+
+    return ans;
+}
+
+// Write the header and the numeric data to the stream
+std::ostream &bnl::wire_write(std::ostream &stream, const bnl::integer &n) {
+    const bnl::ulint head = header(n.size, n.sign);
+    stream.write(reinterpret_cast<const char *>(&head), bnl::ulint_size);
+    stream.write(reinterpret_cast<const char *>(n.data), n.size * bnl::ulint_size);
+
+    return stream;
+}
+
+// Read a number from the stream, sets the fail bit if the data is not valid
+std::istream &bnl::wire_read(std::istream &stream, bnl::integer &n) {
+    // Header
+    bnl::ulint head;
+    if (!stream.read(reinterpret_cast<char *>(&head), bnl::ulint_size))
+        return stream;
+
+    // Check the size, the bytes of the numeric data must fit in a std::size_t
+    const bnl::ulint blocks = head >> 1;
+    if (!blocks || (blocks > max_blocks)) {
+        stream.setstate(std::ios::failbit);
+        return stream;
+    }
+
+    // Numeric data read in chunks, so the memory reserved never exceeds twice
+    // the data the stream really has, whatever size the header claims
+    std::vector<bnl::ulint> data;
+    while (data.size() < blocks) {
+        const std::size_t read = data.size();
+        data.resize(read + std::min(wire_chunk, static_cast<std::size_t>(blocks) - read));
+        if (!stream.read(reinterpret_cast<char *>(&data[read]), (data.size() - read) * bnl::ulint_size))
+            return stream;
+    }
+
+    if (!normalized(&data[0], data.size(), head & 1)) {
+        stream.setstate(std::ios::failbit);
+        return stream;
+    }
+
+    // Copy to the number, the previous numeric data is released
+    n = bnl::integer(bnl::integer_view(&data[0], data.size(), head & 1));
+
+    return stream;
+}
@@ -0,0 +1,27 @@
+#ifndef __BNL_SERIALIZE_HPP_
+#define __BNL_SERIALIZE_HPP_
+
+#include "integer.hpp" // bnl::integer, bnl::uchar, bnl::endian
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+#include <istream> // std::istream
+#include <ostream> // std::ostream
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Binary import and export functions
+    const std::vector<bnl::uchar> export_bytes(const bnl::integer &n, const std::size_t &size = 1, const bnl::endian &words = bnl::big_endian, const bnl::endian &bytes = bnl::big_endian);
+    const bnl::integer import_bytes(const bnl::uchar *const data, const std::size_t &count, const std::size_t &size = 1, const bnl::endian &words = bnl::big_endian, const bnl::endian &bytes = bnl::big_endian);
+    const bnl::integer import_bytes(const std::vector<bnl::uchar> &data, const std::size_t &size = 1, const bnl::endian &words = bnl::big_endian, const bnl::endian &bytes = bnl::big_endian);
+
+    // Wire format functions
+    std::size_t wire_size(const bnl::integer &n);
+    std::size_t wire_write(const bnl::integer &n, bnl::uchar *const buffer);
+    const bnl::integer wire_read(const bnl::uchar *const buffer, const std::size_t &size, std::size_t *const used = NULL);
+    std::ostream &wire_write(std::ostream &stream, const bnl::integer &n);
+    std::istream &wire_read(std::istream &stream, bnl::integer &n);
+}
+
+#endif // __BNL_SERIALIZE_HPP_
@@ -0,0 +1,218 @@
+#include "stats.hpp"
+
+#include <cstdlib>  // std::getenv, std::atexit
+#include <cstring>  // std::memset
+#include <fstream>  // std::ofstream
+#include <iomanip>  // std::setw
+#include <iostream> // std::cerr
+
+#include <time.h> // clock_gettime, CLOCK_MONOTONIC
+
+
+// Names of the operators and algorithms
+static const char *const names[bnl::STAT_COUNT] = {
+    "add", "sub", "mul", "sqr", "div", "shl", "shr", "and", "or", "xor", "gcd", "str", "parse",
+    "mul_basecase", "mul_karatsuba", "mul_ntt", "sqr_basecase", "sqr_karatsuba", "div_long", "radix_split", "radix_join"
+};
+
+
+#ifdef BNL_STATS
+
+// Counters state
+
+// Counters of all the threads, updated atomically
+static bnl::stats_t counters;
+
+// Running calls of each operator and algorithm in the calling thread, the
+// memory it reserves is added to all the running ones
+static __thread std::size_t running[bnl::STAT_COUNT];
+
+// Add to a counter of all the threads
+static inline void add(bnl::ulint &counter, const bnl::ulint &value) {
+    __sync_fetch_and_add(&counter, value);
+}
+
+// Monotonic time in nanoseconds
+static bnl::ulint now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return static_cast<bnl::ulint>(t.tv_sec) * 1000000000 + t.tv_nsec;
+}
+
+// Histogram bucket of a size in data blocks, its bit length
+static std::size_t bucket(std::size_t blocks) {
+    std::size_t k = 0;
+    for (; blocks && (k < bnl::stat_buckets - 1); k++)
+        blocks >>= 1;
+
+    return k;
+}
+
+// Count a memory call in the running operators and algorithms of the calling
+// thread
+static void reserve(const std::size_t &bytes) {
+    for (std::size_t i = 0; i < bnl::STAT_COUNT; i++) {
+        if (running[i]) {
+            add(counters.entries[i].allocations, 1);
+            add(counters.entries[i].bytes, bytes);
+        }
+    }
+
+    add(counters.bytes, bytes);
+}
+
+// Write the counters to the file of the BNL_STATS_OUTPUT environment variable
+// at the program exit, or to the standard error if it is "-"
+static void dump_at_exit() {
+    const char *const output = std::getenv("BNL_STATS_OUTPUT");
+    if (!output || !*output)
+        return;
+
+    if ((output[0] == '-') && !output[1]) {
+        bnl::dump_stats(std::cerr);
+        return;
+    }
+
+    std::ofstream file(output);
+    if (file)
+        bnl::dump_stats(file);
+}
+
+// Registers the dump before any counter is updated
+struct exit_dump_t {
+    exit_dump_t() {
+        std::atexit(dump_at_exit);
+    }
+};
+
+static const exit_dump_t exit_dump;
+
+#endif // BNL_STATS
+
+
+// Constructor
+
+// Count a call of the given operator or algorithm
+#ifdef BNL_STATS
+bnl::stat_scope::stat_scope(const bnl::stat_t &stat, const std::size_t &blocks) : stat(stat), start(running[stat]++ ? 0 : now()) {
+    add(counters.entries[stat].calls, 1);
+    add(counters.entries[stat].histogram[bucket(blocks)], 1);
+}
+#else
+bnl::stat_scope::stat_scope(const bnl::stat_t &stat, const std::size_t &) : stat(stat), start(0) {}
+#endif
+
+
+// Destructor
+
+// Add the elapsed time of the outermost call
+bnl::stat_scope::~stat_scope() {
+#ifdef BNL_STATS
+    if (!--running[stat])
+        add(counters.entries[stat].nanoseconds, now() - start);
+#endif
+}
+
+
+// Instrumentation functions
+
+// Snapshot of the counters
+const bnl::stats_t bnl::stats() {
+    bnl::stats_t ans;
+#ifdef BNL_STATS
+    ans = counters;
+    ans.enabled = true;
+#else
+    std::memset(&ans, 0, sizeof(ans));
+#endif
+
+    return ans;
+}
+
+// Reset all the counters
+void bnl::reset_stats() {
+#ifdef BNL_STATS
+    std::memset(&counters, 0, sizeof(counters));
+#endif
+}
+
+// Name of an operator or algorithm
+const char *bnl::stat_name(const bnl::stat_t &stat) {
+    return stat < bnl::STAT_COUNT ? names[stat] : "unknown";
+}
+
+// Write the counters of the called operators and algorithms as text, one line
+// for each one followed by its non-empty histogram buckets
+void bnl::dump_stats(std::ostream &stream) {
+    const bnl::stats_t s = bnl::stats();
+    if (!s.enabled) {
+        stream << "bnl stats: disabled, build with BNL_STATS defined" << std::endl;
+        return;
+    }
+
+    stream << "bnl stats:" << std::endl;
+    stream << std::setw(16) << "name" << std::setw(12) << "calls" << std::setw(16) << "total_ns" << std::setw(12) << "mean_ns"
+           << std::setw(12) << "allocs" << std::setw(16) << "bytes" << std::endl;
+
+    for (std::size_t i = 0; i < bnl::STAT_COUNT; i++) {
+        const bnl::stat_entry_t &e = s.entries[i];
+        if (!e.calls)
+            continue;
+
+        stream << std::setw(16) << names[i] << std::setw(12) << e.calls << std::setw(16) << e.nanoseconds << std::setw(12) << e.nanoseconds / e.calls
+               << std::setw(12) << e.allocations << std::setw(16) << e.bytes << std::endl;
+
+        // Sizes from 2^(k - 1) data blocks
+        stream << std::setw(16) << "blocks";
+        for (std::size_t k = 0; k < bnl::stat_buckets; k++)
+            if (e.histogram[k])
+                stream << " " << (k ? static_cast<bnl::ulint>(1) << (k - 1) : 0) << "+:" << e.histogram[k];
+
+        stream << std::endl;
+    }
+
+    stream << "memory: " << s.mallocs << " mallocs, " << s.reallocs << " reallocs, " << s.frees << " frees, " << s.bytes << " bytes" << std::endl;
+    stream << "shrink: " << s.shrinks << " reallocs, " << s.shrunk_bytes << " bytes released" << std::endl;
+}
+
+
+// Memory hooks
+
+// Count a reserved block
+void bnl::stat_malloc(const std::size_t &bytes) {
+#ifdef BNL_STATS
+    add(counters.mallocs, 1);
+    reserve(bytes);
+#else
+    static_cast<void>(bytes);
+#endif
+}
+
+// Count a resized block, only the growth is reserved memory
+void bnl::stat_realloc(const std::size_t &old_bytes, const std::size_t &new_bytes) {
+#ifdef BNL_STATS
+    add(counters.reallocs, 1);
+    reserve(new_bytes > old_bytes ? new_bytes - old_bytes : 0);
+#else
+    static_cast<void>(old_bytes);
+    static_cast<void>(new_bytes);
+#endif
+}
+
+// Count a released block
+void bnl::stat_free() {
+#ifdef BNL_STATS
+    add(counters.frees, 1);
+#endif
+}
+
+// Count a resize done to shrink a number
+void bnl::stat_shrink(const std::size_t &old_bytes, const std::size_t &new_bytes) {
+#ifdef BNL_STATS
+    add(counters.shrinks, 1);
+    add(counters.shrunk_bytes, old_bytes - new_bytes);
+#else
+    static_cast<void>(old_bytes);
+    static_cast<void>(new_bytes);
+#endif
+}
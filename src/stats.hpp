@@ -0,0 +1,153 @@
+#ifndef __BNL_STATS_HPP_
+#define __BNL_STATS_HPP_
+
+#include "bnl.hpp" // bnl::ulint
+
+#include <cstddef> // std::size_t
+#include <ostream> // std::ostream
+
+
+// Instrumentation of the operators and the algorithms, compiled out unless the
+// library is built with BNL_STATS defined. The scopes are declared at the
+// start of each instrumented function, and they count its calls and the size
+// of its operands. The time and the memory reserved by the calling thread are
+// counted once for the outermost call of each operator or algorithm, including
+// the nested calls of the others
+#ifdef BNL_STATS
+#define BNL_STAT(stat, blocks) const bnl::stat_scope bnl_stat_scope(stat, blocks)
+#else
+#define BNL_STAT(stat, blocks) static_cast<void>(0)
+#endif
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Instrumented operators and algorithms
+    enum stat_t {
+        // Operators and functions
+        STAT_ADD,
+        STAT_SUB,
+        STAT_MUL,
+        STAT_SQR,
+        STAT_DIV,
+        STAT_SHL,
+        STAT_SHR,
+        STAT_AND,
+        STAT_OR,
+        STAT_XOR,
+        STAT_GCD,
+        STAT_STR,
+        STAT_PARSE,
+
+        // Algorithm tiers, each level of the recursive ones is a call
+        STAT_MUL_BASECASE,
+        STAT_MUL_KARATSUBA,
+        STAT_MUL_NTT,
+        STAT_SQR_BASECASE,
+        STAT_SQR_KARATSUBA,
+        STAT_DIV_LONG,
+        STAT_RADIX_SPLIT,
+        STAT_RADIX_JOIN,
+
+        // Number of instrumented operators and algorithms
+        STAT_COUNT
+    };
+
+    // Buckets of the operand size histograms, the bucket k counts the calls
+    // whose largest operand has from 2^(k - 1) to 2^k - 1 data blocks
+    static const std::size_t stat_buckets = 64;
+
+    // Counters of an operator or algorithm
+    struct stat_entry_t {
+        // Calls
+        bnl::ulint calls;
+
+        // Time in nanoseconds of the outermost calls
+        bnl::ulint nanoseconds;
+
+        // Blocks reserved and resized by the calling thread during the
+        // outermost calls, and their bytes
+        bnl::ulint allocations;
+        bnl::ulint bytes;
+
+        // Calls by the size of the largest operand
+        bnl::ulint histogram[bnl::stat_buckets];
+    };
+
+    // Snapshot of the counters
+    struct stats_t {
+        // Whether the library was built with the instrumentation
+        bool enabled;
+
+        // Counters of each operator and algorithm
+        bnl::stat_entry_t entries[bnl::STAT_COUNT];
+
+        // Numeric data memory calls of all the threads, and the reserved bytes
+        bnl::ulint mallocs;
+        bnl::ulint reallocs;
+        bnl::ulint frees;
+        bnl::ulint bytes;
+
+        // Resizes of the numeric data done to shrink the numbers, and the
+        // released bytes
+        bnl::ulint shrinks;
+        bnl::ulint shrunk_bytes;
+    };
+
+
+    // Scope of an instrumented call, declared by the BNL_STAT macro
+    class stat_scope {
+        private:
+            // Operator or algorithm of the call
+            const bnl::stat_t stat;
+
+            // Start time in nanoseconds of the outermost call of the same
+            // operator or algorithm in the calling thread, zero in the nested
+            // ones
+            const bnl::ulint start;
+
+
+            // Deleted constructors and operators
+            stat_scope(const bnl::stat_scope &);
+            bnl::stat_scope &operator = (const bnl::stat_scope &);
+
+
+        public:
+            // Constructor
+
+            // Count a call of the given operator or algorithm, with its
+            // largest operand size in data blocks
+            stat_scope(const bnl::stat_t &stat, const std::size_t &blocks);
+
+
+            // Destructor
+
+            // Add the elapsed time of the outermost call
+            ~stat_scope();
+    };
+
+
+    // Instrumentation functions
+
+    // Snapshot of the counters, exact when no operation is running
+    const bnl::stats_t stats();
+
+    // Reset all the counters, it must not be called while an operation is
+    // running
+    void reset_stats();
+
+    // Name of an operator or algorithm
+    const char *stat_name(const bnl::stat_t &stat);
+
+    // Write the counters of the called operators and algorithms as text
+    void dump_stats(std::ostream &stream);
+
+
+    // Memory hooks of the numeric data functions, no-ops without BNL_STATS
+    void stat_malloc(const std::size_t &bytes);
+    void stat_realloc(const std::size_t &old_bytes, const std::size_t &new_bytes);
+    void stat_free();
+    void stat_shrink(const std::size_t &old_bytes, const std::size_t &new_bytes);
+}
+
+#endif // __BNL_STATS_HPP_
@@ -0,0 +1,23 @@
+#ifndef __BNL_TUNED_HPP_
+#define __BNL_TUNED_HPP_
+
+#include <cstddef> // std::size_t
+
+
+// Algorithm thresholds generated by bnl-tune, see tune/tune.cpp. Run make tune
+// to measure them on the host and write this file again
+namespace bnl {
+    namespace tuned {
+        static const std::size_t karatsuba_mul = 32;
+        static const std::size_t karatsuba_sqr = 48;
+        static const std::size_t ntt_mul = 2048;
+        static const std::size_t ntt_sqr = 3072;
+        static const std::size_t lehmer = 16;
+        static const std::size_t reciprocal = 32;
+        static const std::size_t short_division = 64;
+        static const std::size_t split = 512;
+        static const std::size_t join = 64;
+    }
+}
+
+#endif // __BNL_TUNED_HPP_
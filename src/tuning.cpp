@@ -0,0 +1,115 @@
+#include "tuning.hpp"
+#include "tuned.hpp" // bnl::tuned
+
+#include <cstdlib> // std::getenv, std::strtoul
+
+#include <pthread.h> // pthread_once_t, pthread_once
+
+
+// Sizes
+
+// Smallest valid value of each threshold, the recursive algorithms need at
+// least this size to make progress
+static const bnl::thresholds_t minimum = {4, 4, 4, 4, 2, 3, 8, 1, 2};
+
+
+// Thresholds state
+
+// Current thresholds, constant initialized with the tuned ones and overridden
+// by the environment variables on the first call
+static bnl::thresholds_t current = {
+    bnl::tuned::karatsuba_mul,
+    bnl::tuned::karatsuba_sqr,
+    bnl::tuned::ntt_mul,
+    bnl::tuned::ntt_sqr,
+    bnl::tuned::lehmer,
+    bnl::tuned::reciprocal,
+    bnl::tuned::short_division,
+    bnl::tuned::split,
+    bnl::tuned::join
+};
+
+// Whether the environment variables were read
+static pthread_once_t loaded = PTHREAD_ONCE_INIT;
+
+// Raise a threshold to its smallest valid value
+static void at_least(std::size_t &value, const std::size_t &least) {
+    if (value < least)
+        value = least;
+}
+
+// Raise each threshold to its smallest valid value
+static void clamp(bnl::thresholds_t &t) {
+    at_least(t.karatsuba_mul, minimum.karatsuba_mul);
+    at_least(t.karatsuba_sqr, minimum.karatsuba_sqr);
+    at_least(t.ntt_mul, minimum.ntt_mul);
+    at_least(t.ntt_sqr, minimum.ntt_sqr);
+    at_least(t.lehmer, minimum.lehmer);
+    at_least(t.reciprocal, minimum.reciprocal);
+    at_least(t.short_division, minimum.short_division);
+    at_least(t.split, minimum.split);
+    at_least(t.join, minimum.join);
+}
+
+// Override a threshold by an environment variable holding a decimal number
+static void environment(const char *const name, std::size_t &value) {
+    const char *const text = std::getenv(name);
+    if (!text || !*text)
+        return;
+
+    // Ignore the values that aren't numbers
+    char *end = NULL;
+    const unsigned long int number = std::strtoul(text, &end, 10);
+    if (!*end)
+        value = number;
+}
+
+// Read the environment variables once
+static void load() {
+    environment("BNL_THRESHOLD_KARATSUBA_MUL", current.karatsuba_mul);
+    environment("BNL_THRESHOLD_KARATSUBA_SQR", current.karatsuba_sqr);
+    environment("BNL_THRESHOLD_NTT_MUL", current.ntt_mul);
+    environment("BNL_THRESHOLD_NTT_SQR", current.ntt_sqr);
+    environment("BNL_THRESHOLD_LEHMER", current.lehmer);
+    environment("BNL_THRESHOLD_RECIPROCAL", current.reciprocal);
+    environment("BNL_THRESHOLD_SHORT_DIVISION", current.short_division);
+    environment("BNL_THRESHOLD_SPLIT", current.split);
+    environment("BNL_THRESHOLD_JOIN", current.join);
+
+    clamp(current);
+}
+
+
+// Thresholds configuration
+
+// Thresholds of the generated header
+const bnl::thresholds_t bnl::tuned_thresholds() {
+    const bnl::thresholds_t t = {
+        bnl::tuned::karatsuba_mul,
+        bnl::tuned::karatsuba_sqr,
+        bnl::tuned::ntt_mul,
+        bnl::tuned::ntt_sqr,
+        bnl::tuned::lehmer,
+        bnl::tuned::reciprocal,
+        bnl::tuned::short_division,
+        bnl::tuned::split,
+        bnl::tuned::join
+    };
+
+    return t;
+}
+
+// Current thresholds, reading the environment variables on the first call
+const bnl::thresholds_t &bnl::thresholds() {
+    pthread_once(&loaded, load);
+    return current;
+}
+
+// Set the current thresholds, the environment variables are read before so
+// they don't override the given ones later
+void bnl::set_thresholds(const bnl::thresholds_t &t) {
+    pthread_once(&loaded, load);
+
+    current = t;
+    clamp(current);
+}
@@ -0,0 +1,58 @@
+#ifndef __BNL_TUNING_HPP_
+#define __BNL_TUNING_HPP_
+
+#include <cstddef> // std::size_t
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Size thresholds of the algorithms chosen by the dispatch code. The sizes
+    // are in data blocks but the join threshold, in decimal chunks of 9 digits
+    struct thresholds_t {
+        // Minimum size of both operands to multiply, and to square, with
+        // Karatsuba's algorithm
+        std::size_t karatsuba_mul;
+        std::size_t karatsuba_sqr;
+
+        // Minimum size of both operands to multiply, and to square, with the
+        // number theoretic transform
+        std::size_t ntt_mul;
+        std::size_t ntt_sqr;
+
+        // Lehmer's steps of the greatest common divisor while the smaller
+        // number is larger than this size
+        std::size_t lehmer;
+
+        // Minimum size of the reciprocals computed by Newton's iteration
+        std::size_t reciprocal;
+
+        // Minimum size of the numbers split by a power in the decimal
+        // conversion, the smaller ones are split by short division
+        std::size_t short_division;
+
+        // Minimum size of the numbers converted to decimal by divide and
+        // conquer
+        std::size_t split;
+
+        // Minimum number of decimal chunks joined in a number by divide and
+        // conquer
+        std::size_t join;
+    };
+
+
+    // Thresholds configuration
+
+    // Thresholds of the generated tuned.hpp header, measured by bnl-tune
+    const bnl::thresholds_t tuned_thresholds();
+
+    // Current thresholds, the tuned ones overridden by the BNL_THRESHOLD_*
+    // environment variables, like BNL_THRESHOLD_KARATSUBA_MUL, read on the
+    // first call
+    const bnl::thresholds_t &thresholds();
+
+    // Set the current thresholds, raising each one to its smallest valid
+    // value. It must not be called while an operation is running
+    void set_thresholds(const bnl::thresholds_t &t);
+}
+
+#endif // __BNL_TUNING_HPP_
@@ -0,0 +1,86 @@
+#include "view.hpp"
+#include "integer.hpp" // bnl::integer
+
+#include <stdexcept> // std::invalid_argument
+
+
+// Constants
+
+// Data block of the views of zero
+static const bnl::ulint zero_block = 0;
+
+
+// Private constructors
+
+// View of numeric data already normalized
+bnl::integer_view::integer_view(const bnl::ulint *const data, const std::size_t &size, const bool &sign, const bool &whole) : data(data), size(size), sign(sign), whole(whole) {}
+
+
+// Public constructors
+
+// View of a number
+bnl::integer_view::integer_view(const bnl::integer &n) : data(n.data), size(n.size), sign(n.sign), whole(true) {}
+
+// View of the given data blocks, without its leading zero blocks
+bnl::integer_view::integer_view(const bnl::ulint *const data, const std::size_t &size, const bool &sign) : data(data), size(size), sign(sign), whole(false) {
+    // Each block has 32 bits
+    for (std::size_t i = 0; i < size; i++)
+        if (data[i] > bnl::integer::base_mask)
+            throw std::invalid_argument("can't build bnl::integer_view: data block out of range");
+
+    // Leading zero blocks
+    while (this->size && !data[this->size - 1])
+        this->size--;
+
+    // Zero is never negative
+    if (!this->size) {
+        this->data = &zero_block;
+        this->size = 1;
+        this->sign = false;
+    }
+}
+
+
+// Methods
+
+// The n lowest data blocks of the magnitude
+const bnl::integer_view bnl::integer_view::low(const std::size_t &blocks) const {
+    // Nothing to truncate
+    if (size <= blocks)
+        return bnl::abs(*this);
+
+    // Lowest blocks without the leading zero blocks
+    std::size_t n = blocks;
+    while (n && !data[n - 1])
+        n--;
+
+    return n ? bnl::integer_view(data, n, false, false) : bnl::integer_view(&zero_block, 1, false, false);
+}
+
+// The magnitude without the n lowest data blocks
+const bnl::integer_view bnl::integer_view::high(const std::size_t &blocks) const {
+    // Underflow
+    if (size <= blocks)
+        return bnl::integer_view(&zero_block, 1, false, false);
+
+    // The highest block isn't zero
+    return bnl::integer_view(data + blocks, size - blocks, false, whole && !blocks);
+}
+
+
+// Helpful arithmetic functions
+
+// Returns the view of the absolute value
+const bnl::integer_view bnl::abs(const bnl::integer_view &n) {
+    return bnl::integer_view(n.data, n.size, false, n.whole);
+}
+
+
+// Operators overloading
+
+// Unary operators
+
+// Additive inverse, zero is never negative
+const bnl::integer_view bnl::integer_view::operator - () const {
+    return bnl::integer_view(data, size, !sign && !bnl::iszero(*this), whole);
+}
@@ -0,0 +1,270 @@
+#ifndef __BNL_VIEW_HPP_
+#define __BNL_VIEW_HPP_
+
+#include "bnl.hpp" // bnl::ulint
+
+#include <cstddef> // std::size_t
+#include <ostream> // std::ostream
+#include <string>  // std::string
+
+
+// Forward declaration of the bnl::integer_view class and friend classes
+namespace bnl {
+    class integer;
+    class integer_view;
+
+    class accumulator;
+    class barrett;
+    class mapped;
+    class radix;
+}
+
+
+// Arithmetic operators
+const bnl::integer operator * (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator / (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator % (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator + (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator - (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator << (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator >> (const bnl::integer_view &a, const bnl::integer_view &b);
+
+// Output
+std::ostream &operator << (std::ostream &stream, const bnl::integer_view &n);
+
+// Comparison and relational operators
+bool operator > (const bnl::integer_view &a, const bnl::integer_view &b);
+bool operator < (const bnl::integer_view &a, const bnl::integer_view &b);
+bool operator >= (const bnl::integer_view &a, const bnl::integer_view &b);
+bool operator <= (const bnl::integer_view &a, const bnl::integer_view &b);
+bool operator == (const bnl::integer_view &a, const bnl::integer_view &b);
+bool operator != (const bnl::integer_view &a, const bnl::integer_view &b);
+
+// Bitwise operators
+const bnl::integer operator & (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator | (const bnl::integer_view &a, const bnl::integer_view &b);
+const bnl::integer operator ^ (const bnl::integer_view &a, const bnl::integer_view &b);
+
+
+// Big Numbers Library namespace
+namespace bnl {
+    // Helpful checker functions
+    bool iseven(const bnl::integer_view &n);
+    bool isneg(const bnl::integer_view &n);
+    bool isodd(const bnl::integer_view &n);
+    bool isone(const bnl::integer_view &n);
+    bool ispos(const bnl::integer_view &n);
+    bool iszero(const bnl::integer_view &n);
+
+    // Helpful arithmetic functions
+    const bnl::integer_view abs(const bnl::integer_view &n);
+
+    // Other helpful functions
+    std::string const str(const bnl::integer_view &n, const int &radix = 10);
+
+
+    // Read-only view of numeric data owned by someone else, a number or an
+    // external buffer of data blocks with the bnl::integer layout. The read
+    // only operations take their operands as views, so they compute directly
+    // over the viewed data. The data must outlive the view and must not change
+    // while it is viewed
+    class integer_view {
+        private:
+            // Attributes
+
+            // Numeric data array
+            const bnl::ulint *data;
+
+            // Numeric data array size
+            std::size_t size;
+
+            // Number sign
+            bool sign;
+
+            // Whether the data is the whole numeric data of a number, so the
+            // conversion to a number shares it instead of copying it
+            bool whole;
+
+
+            // Constructors
+
+            // View of numeric data already normalized
+            integer_view(const bnl::ulint *const data, const std::size_t &size, const bool &sign, const bool &whole);
+
+
+        public:
+            // Constructors
+
+            // View of a number
+            integer_view(const bnl::integer &n);
+
+            // View of the given data blocks of 32 bits from the least
+            // significative, the leading zero blocks are left out
+            integer_view(const bnl::ulint *const data, const std::size_t &size, const bool &sign = false);
+
+
+            // Friend classes
+
+            // Arbitrary precision integer
+            friend class bnl::integer;
+
+            // Sum of many numbers with deferred carries
+            friend class bnl::accumulator;
+
+            // Barrett reduction context
+            friend class bnl::barrett;
+
+            // Integer stored in a memory mapped file
+            friend class bnl::mapped;
+
+            // Divide and conquer decimal conversion context
+            friend class bnl::radix;
+
+
+            // Methods
+
+            // The n lowest data blocks of the magnitude
+            const bnl::integer_view low(const std::size_t &blocks) const;
+
+            // The magnitude without the n lowest data blocks
+            const bnl::integer_view high(const std::size_t &blocks) const;
+
+
+            // Returns whether the value is even
+            friend bool iseven(const bnl::integer_view &n);
+
+            // Returns whether the value is negative
+            friend bool isneg(const bnl::integer_view &n);
+
+            // Returns whether the value is odd
+            friend bool isodd(const bnl::integer_view &n);
+
+            // Returns whether the value equals to one, positive or negative
+            friend bool isone(const bnl::integer_view &n);
+
+            // Returns whether the value is positive
+            friend bool ispos(const bnl::integer_view &n);
+
+            // Returns whether the value is zero
+            friend bool iszero(const bnl::integer_view &n);
+
+
+            // Returns the view of the absolute value
+            friend const bnl::integer_view abs(const bnl::integer_view &n);
+
+            // Get the string representation with the given radix
+            friend const std::string str(const bnl::integer_view &n, const int &radix);
+
+            // Returns the hash of a value with the given seed
+            friend std::size_t hash(const bnl::integer_view &n, const std::size_t &seed);
+
+
+            // Operators overloading
+
+            // Unary operators
+
+            // Integer promotion
+            inline const bnl::integer_view &operator + () const {
+                return *this;
+            }
+
+            // Additive inverse, a view of the same data
+            const bnl::integer_view operator - () const;
+
+
+            // Arithmetic operators
+
+            // Multiplication
+            friend const bnl::integer (::operator *) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Division
+            friend const bnl::integer (::operator /) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Modulo
+            friend const bnl::integer (::operator %) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Addition
+            friend const bnl::integer (::operator +) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Subtraction
+            friend const bnl::integer (::operator -) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Left shift
+            friend const bnl::integer (::operator <<) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Right shift
+            friend const bnl::integer (::operator >>) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+
+            // Output
+
+            // Standard output
+            friend std::ostream &::operator << (std::ostream &stream, const bnl::integer_view &n);
+
+
+            // Comparison and relational operators
+
+            // Greater than
+            friend bool ::operator > (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Less than
+            friend bool ::operator < (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Equal to
+            friend bool ::operator == (const bnl::integer_view &a, const bnl::integer_view &b);
+
+
+            // Bitwise operators
+
+            // Bitwise AND
+            friend const bnl::integer (::operator &) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Bitwise OR (inclusive or)
+            friend const bnl::integer (::operator |) (const bnl::integer_view &a, const bnl::integer_view &b);
+
+            // Bitwise XOR (exclusive or)
+            friend const bnl::integer (::operator ^) (const bnl::integer_view &a, const bnl::integer_view &b);
+    };
+
+
+    // Helpful checker functions
+    inline bool iseven(const bnl::integer_view &n) {
+        return !(n.data[0] & 1);
+    }
+
+    inline bool isneg(const bnl::integer_view &n) {
+        return n.sign;
+    }
+
+    inline bool isodd(const bnl::integer_view &n) {
+        return n.data[0] & 1;
+    }
+
+    inline bool isone(const bnl::integer_view &n) {
+        return (n.size == 1) && (n.data[0] == 1);
+    }
+
+    inline bool ispos(const bnl::integer_view &n) {
+        return !n.sign;
+    }
+
+    inline bool iszero(const bnl::integer_view &n) {
+        return (n.size == 1) && (n.data[0] == 0);
+    }
+}
+
+
+// Comparison and relational operators
+inline bool operator >= (const bnl::integer_view &a, const bnl::integer_view &b) {
+    return !(a < b);
+}
+
+inline bool operator <= (const bnl::integer_view &a, const bnl::integer_view &b) {
+    return !(a > b);
+}
+
+inline bool operator != (const bnl::integer_view &a, const bnl::integer_view &b) {
+    return !(a == b);
+}
+
+#endif // __BNL_VIEW_HPP_
@@ -0,0 +1,325 @@
+#include "integer.hpp"
+#include "gcd.hpp"
+#include "serialize.hpp"
+#include "tuning.hpp"
+
+#include <cstdlib>  // std::strtoul, std::strtod, std::rand, std::srand, std::exit
+#include <fstream>  // std::ofstream
+#include <iostream> // std::cout, std::cerr, std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include <time.h> // clock_gettime, CLOCK_MONOTONIC
+
+
+// Tuner options
+struct options_t {
+    // Output header, the standard output if empty
+    std::string output;
+
+    // Measured samples of each timing, the fastest one is kept
+    std::size_t samples;
+
+    // Minimum time of each sample in seconds, repeating the operation
+    double sample_time;
+
+    // Consecutive sizes where the larger algorithm wins to accept a crossover
+    std::size_t wins;
+};
+
+// Operation timed by the tuner
+enum operation_t {
+    MUL,
+    SQR,
+    GCD,
+    STR,
+    PARSE
+};
+
+// Operands of a size
+struct operands_t {
+    bnl::integer a;
+    bnl::integer b;
+    std::string digits;
+};
+
+
+// Tuner state
+
+// Command line options
+static options_t options;
+
+// Result of the last operation, kept so it isn't optimized out
+static bnl::integer sink;
+static std::size_t sink_size = 0;
+
+
+// Timing
+
+// Monotonic time in seconds
+static double now() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Run the operation the given times and returns the elapsed seconds
+static double run(const operation_t &operation, const operands_t &n, const std::size_t &iterations) {
+    const double start = now();
+
+    for (std::size_t i = 0; i < iterations; i++) {
+        switch (operation) {
+            case MUL:
+                sink = n.a * n.b;
+                break;
+
+            case SQR:
+                sink = n.a * n.a;
+                break;
+
+            case GCD:
+                sink = bnl::gcd(n.a, n.b);
+                break;
+
+            case STR:
+                sink_size += bnl::str(n.a).size();
+                break;
+
+            case PARSE:
+                sink = bnl::integer(n.digits);
+                break;
+        }
+    }
+
+    return now() - start;
+}
+
+// Time of a single operation in seconds with the given thresholds, the fastest
+// of the samples
+static double measure(const operation_t &operation, const operands_t &n, const bnl::thresholds_t &t) {
+    bnl::set_thresholds(t);
+
+    // Iterations of each sample from a single timed run, which also warms up
+    const double single = run(operation, n, 1);
+    std::size_t iterations = 1;
+    if (single < options.sample_time)
+        iterations = static_cast<std::size_t>(options.sample_time / (single > 1e-9 ? single : 1e-9)) + 1;
+
+    double best = single;
+    for (std::size_t i = 0; i < options.samples; i++) {
+        const double time = run(operation, n, iterations) / iterations;
+        if (time < best)
+            best = time;
+    }
+
+    return best;
+}
+
+
+// Operands
+
+// Random number of exactly the given data blocks
+static const bnl::integer number(const std::size_t &size) {
+    std::vector<bnl::uchar> bytes(size << 2);
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<bnl::uchar>(std::rand());
+
+    // The most significative byte isn't zero
+    bytes[0] |= 0x80;
+    return bnl::import_bytes(bytes);
+}
+
+// Operands of the given size, the digits are only built for the parse
+static void build(const std::size_t &size, operands_t &n, const operation_t &operation) {
+    n.a = number(size);
+    n.b = number(size);
+    n.digits = operation == PARSE ? bnl::str(n.a) : std::string();
+}
+
+
+// Threshold searches
+
+// Crossover of a threshold, the smallest size from which running one level of
+// the larger algorithm is faster than the smaller one for the given
+// consecutive sizes. The sizes grow geometrically from the smallest one, and
+// the largest one is returned if there is no crossover
+static std::size_t crossover(const char *const name, const operation_t &operation, std::size_t bnl::thresholds_t::*const field, const std::size_t &min, const std::size_t &max) {
+    bnl::thresholds_t t = bnl::thresholds();
+    std::size_t found = 0;
+    std::size_t wins = 0;
+
+    for (std::size_t size = min; size <= max; size += (size >> 3) + 1) {
+        // Parse sizes are measured in decimal chunks
+        operands_t n;
+        build(operation == PARSE ? (size * 15 >> 4) + 1 : size, n, operation);
+        const std::size_t at = operation == PARSE ? (n.digits.size() + 8) / 9 : size;
+
+        // The smaller algorithm at this size, and the larger one
+        t.*field = at + 1;
+        const double small = measure(operation, n, t);
+        t.*field = at;
+        const double large = measure(operation, n, t);
+
+        std::cerr << name << " " << at << ": " << small * 1e9 << " ns, " << large * 1e9 << " ns" << std::endl;
+
+        if (large < small) {
+            if (!wins++)
+                found = at;
+
+            if (wins == options.wins)
+                return found;
+        }
+        else
+            wins = 0;
+    }
+
+    return wins ? found : max;
+}
+
+// Candidate of a threshold with the fastest operation over operands of the
+// given size
+static std::size_t fastest(const char *const name, const operation_t &operation, std::size_t bnl::thresholds_t::*const field, const std::size_t *const candidates, const std::size_t &count, const std::size_t &size) {
+    bnl::thresholds_t t = bnl::thresholds();
+    operands_t n;
+    build(size, n, operation);
+
+    std::size_t best = t.*field;
+    double time = 0;
+
+    for (std::size_t i = 0; i < count; i++) {
+        t.*field = candidates[i];
+        const double current = measure(operation, n, t);
+        std::cerr << name << " " << candidates[i] << ": " << current * 1e9 << " ns" << std::endl;
+
+        if (!i || (current < time)) {
+            best = candidates[i];
+            time = current;
+        }
+    }
+
+    return best;
+}
+
+// Search a threshold and keep it for the next ones
+static void tune(std::size_t bnl::thresholds_t::*const field, const std::size_t &value) {
+    bnl::thresholds_t t = bnl::thresholds();
+    t.*field = value;
+    bnl::set_thresholds(t);
+}
+
+
+// Output
+
+// Write the generated header
+static void header(std::ostream &stream, const bnl::thresholds_t &t) {
+    stream << "#ifndef __BNL_TUNED_HPP_" << std::endl
+           << "#define __BNL_TUNED_HPP_" << std::endl
+           << std::endl
+           << "#include <cstddef> // std::size_t" << std::endl
+           << std::endl
+           << std::endl
+           << "// Algorithm thresholds generated by bnl-tune, see tune/tune.cpp. Run make tune" << std::endl
+           << "// to measure them on the host and write this file again" << std::endl
+           << "namespace bnl {" << std::endl
+           << "    namespace tuned {" << std::endl
+           << "        static const std::size_t karatsuba_mul = " << t.karatsuba_mul << ";" << std::endl
+           << "        static const std::size_t karatsuba_sqr = " << t.karatsuba_sqr << ";" << std::endl
+           << "        static const std::size_t ntt_mul = " << t.ntt_mul << ";" << std::endl
+           << "        static const std::size_t ntt_sqr = " << t.ntt_sqr << ";" << std::endl
+           << "        static const std::size_t lehmer = " << t.lehmer << ";" << std::endl
+           << "        static const std::size_t reciprocal = " << t.reciprocal << ";" << std::endl
+           << "        static const std::size_t short_division = " << t.short_division << ";" << std::endl
+           << "        static const std::size_t split = " << t.split << ";" << std::endl
+           << "        static const std::size_t join = " << t.join << ";" << std::endl
+           << "    }" << std::endl
+           << "}" << std::endl
+           << std::endl
+           << "#endif // __BNL_TUNED_HPP_" << std::endl;
+}
+
+
+// Command line
+
+// Print the usage and exit
+static void usage(const int &status) {
+    std::cerr << "Usage: bnl-tune [options]" << std::endl
+              << "  --output FILE       Generated header (standard output)" << std::endl
+              << "  --samples N         Measured samples of each timing (3)" << std::endl
+              << "  --sample-time S     Minimum seconds of each sample (0.01)" << std::endl
+              << "  --wins N            Consecutive wins to accept a crossover (3)" << std::endl;
+
+    std::exit(status);
+}
+
+// Parse the command line arguments
+static void parse(const int &argc, char **const argv) {
+    options.samples = 3;
+    options.sample_time = 0.01;
+    options.wins = 3;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if ((arg == "-h") || (arg == "--help"))
+            usage(0);
+
+        if (i + 1 == argc)
+            usage(1);
+
+        const std::string value = argv[++i];
+        if (arg == "--output")
+            options.output = value;
+        else if (arg == "--samples")
+            options.samples = std::strtoul(value.c_str(), NULL, 10);
+        else if (arg == "--sample-time")
+            options.sample_time = std::strtod(value.c_str(), NULL);
+        else if (arg == "--wins")
+            options.wins = std::strtoul(value.c_str(), NULL, 10);
+        else
+            usage(1);
+    }
+
+    if (!options.samples || !options.wins)
+        usage(1);
+}
+
+
+// Main
+
+int main(int argc, char **argv) {
+    parse(argc, argv);
+    std::srand(1);
+
+    // Each search runs with the thresholds found before it, from the
+    // multiplication kernels used by all the other algorithms
+    tune(&bnl::thresholds_t::karatsuba_mul, crossover("karatsuba_mul", MUL, &bnl::thresholds_t::karatsuba_mul, 4, 256));
+    tune(&bnl::thresholds_t::karatsuba_sqr, crossover("karatsuba_sqr", SQR, &bnl::thresholds_t::karatsuba_sqr, 4, 256));
+    tune(&bnl::thresholds_t::ntt_mul, crossover("ntt_mul", MUL, &bnl::thresholds_t::ntt_mul, 256, 32768));
+    tune(&bnl::thresholds_t::ntt_sqr, crossover("ntt_sqr", SQR, &bnl::thresholds_t::ntt_sqr, 256, 32768));
+
+    // The decimal conversion, the division thresholds are measured converting
+    // a number large enough to use them
+    static const std::size_t reciprocals[] = {4, 8, 12, 16, 24, 32, 48, 64, 96, 128};
+    static const std::size_t divisions[] = {8, 16, 24, 32, 48, 64, 96, 128, 192, 256};
+    tune(&bnl::thresholds_t::split, 64);
+    tune(&bnl::thresholds_t::reciprocal, fastest("reciprocal", STR, &bnl::thresholds_t::reciprocal, reciprocals, sizeof(reciprocals) / sizeof(*reciprocals), 4096));
+    tune(&bnl::thresholds_t::short_division, fastest("short_division", STR, &bnl::thresholds_t::short_division, divisions, sizeof(divisions) / sizeof(*divisions), 4096));
+    tune(&bnl::thresholds_t::split, crossover("split", STR, &bnl::thresholds_t::split, 64, 8192));
+    tune(&bnl::thresholds_t::join, crossover("join", PARSE, &bnl::thresholds_t::join, 8, 1024));
+
+    // Lehmer's steps of the greatest common divisor
+    static const std::size_t lehmers[] = {2, 4, 8, 12, 16, 24, 32, 48, 64};
+    tune(&bnl::thresholds_t::lehmer, fastest("lehmer", GCD, &bnl::thresholds_t::lehmer, lehmers, sizeof(lehmers) / sizeof(*lehmers), 256));
+
+    // Write the header
+    std::ofstream file;
+    if (!options.output.empty()) {
+        file.open(options.output.c_str());
+        if (!file) {
+            std::cerr << "can't open " << options.output << std::endl;
+            return 1;
+        }
+    }
+
+    header(options.output.empty() ? std::cout : file, bnl::thresholds());
+    return 0;
+}